@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef ALIGNED_ALLOCATOR_HPP_
+#define ALIGNED_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief Allocator returning memory aligned to a given boundary.
+ *
+ * Aligning arrays to a cache line lets vectorized loops use aligned loads
+ * and stores and keeps a vector from being split across two cache lines.
+ * Values kept in the inline storage of an array only have the alignment of
+ * their type, so arrays that must always be aligned use an inline capacity
+ * of 0.
+ */
+template <typename _content_type, std::size_t _alignment = 64>
+class aligned_allocator {
+  public: // Typedefs
+    /**
+     * @brief The type of the allocated values.
+     */
+    typedef _content_type value_type;
+
+  public: // Classes
+    /**
+     * @brief Rebinds the allocator to another type with the same alignment.
+     */
+    template <typename _other_content_type>
+    struct rebind {
+        typedef aligned_allocator<_other_content_type, _alignment> other;
+    };
+
+  public: // Static members
+    /**
+     * @brief The alignment of the allocated memory.
+     */
+    static const constexpr std::size_t alignment{std::max(_alignment, alignof(value_type))};
+
+    /**
+     * @brief Verify that the alignment is a power of two.
+     */
+    static_assert((alignment & (alignment - 1)) == 0, "The alignment is required to be a power of two.");
+
+  public: // Constructors and destructor
+    /**
+     * @brief Default constructor.
+     */
+    aligned_allocator() = default;
+
+    /**
+     * @brief Rebinding constructor.
+     */
+    template <typename _other_content_type>
+    aligned_allocator(const aligned_allocator<_other_content_type, _alignment> &)
+    {
+    }
+
+  public: // Functionality
+    /**
+     * @brief Allocates aligned memory for the given amount of values.
+     */
+    value_type *allocate(const std::size_t &_count)
+    {
+        if (_count > SIZE_MAX / sizeof(value_type)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<value_type *>(::operator new(_count * sizeof(value_type), std::align_val_t{alignment}));
+    }
+
+    /**
+     * @brief Frees the memory of the given amount of values.
+     */
+    void deallocate(value_type *_pointer, const std::size_t &)
+    {
+        ::operator delete(_pointer, std::align_val_t{alignment});
+    }
+
+  public: // Operators
+    /**
+     * @brief All aligned allocators with the same alignment are equal.
+     */
+    template <typename _other_content_type>
+    bool operator==(const aligned_allocator<_other_content_type, _alignment> &) const
+    {
+        return true;
+    }
+
+    /**
+     * @brief All aligned allocators with the same alignment are equal.
+     */
+    template <typename _other_content_type>
+    bool operator!=(const aligned_allocator<_other_content_type, _alignment> &) const
+    {
+        return false;
+    }
+};
+
+#endif // ALIGNED_ALLOCATOR_HPP_
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "arena.hpp"
+
+#include <algorithm>
+
+monotonic_arena::monotonic_arena(const std::size_t &_block_size)
+    : m_block_size{_block_size},
+      m_blocks{nullptr},
+      m_current{nullptr},
+      m_end{nullptr},
+      m_block_count{0}
+{
+}
+
+monotonic_arena::~monotonic_arena()
+{
+    while (m_blocks) {
+        block *const next{m_blocks->next};
+        ::operator delete(m_blocks);
+        m_blocks = next;
+    }
+}
+
+std::size_t monotonic_arena::block_count() const
+{
+    return m_block_count;
+}
+
+void *monotonic_arena::allocate(const std::size_t &_size, const std::size_t &_alignment)
+{
+    unsigned char *pointer{m_current ? align(m_current, _alignment) : nullptr};
+
+    if (!pointer || pointer > m_end || static_cast<std::size_t>(m_end - pointer) < _size) {
+        if (_size + _alignment > m_block_size) {
+            // Large allocations get their own block, so the current block
+            // can still be used for further allocations.
+            block *const large{allocate_block(_size + _alignment)};
+
+            if (m_blocks) {
+                large->next     = m_blocks->next;
+                m_blocks->next = large;
+            } else {
+                m_blocks = large;
+            }
+
+            return align(data(large), _alignment);
+        }
+
+        block *const regular{allocate_block(m_block_size)};
+        regular->next = m_blocks;
+        m_blocks      = regular;
+
+        m_end   = data(regular) + m_block_size;
+        pointer = align(data(regular), _alignment);
+    }
+
+    m_current = pointer + _size;
+
+    return pointer;
+}
+
+void monotonic_arena::release()
+{
+    if (m_blocks && !m_blocks->next && m_current) {
+        m_current = data(m_blocks);
+        return;
+    }
+
+    std::size_t size{0};
+    while (m_blocks) {
+        block *const next{m_blocks->next};
+        size += m_blocks->size;
+        ::operator delete(m_blocks);
+        m_blocks = next;
+    }
+
+    m_block_size = std::max(m_block_size, size);
+    m_current    = nullptr;
+    m_end        = nullptr;
+}
+
+monotonic_arena::block *monotonic_arena::allocate_block(const std::size_t &_size)
+{
+    block *const ret{static_cast<block *>(::operator new(s_header_size + _size))};
+    ret->next = nullptr;
+    ret->size = _size;
+
+    ++m_block_count;
+
+    return ret;
+}
+
+unsigned char *monotonic_arena::data(block *_block)
+{
+    return reinterpret_cast<unsigned char *>(_block) + s_header_size;
+}
+
+unsigned char *monotonic_arena::align(unsigned char *_pointer, const std::size_t &_alignment)
+{
+    const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(_pointer)};
+    const std::uintptr_t mask{static_cast<std::uintptr_t>(_alignment - 1)};
+
+    return _pointer + (((address + mask) & ~mask) - address);
+}
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef ARENA_HPP_
+#define ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief A monotonic memory arena handing out memory from large blocks.
+ *
+ * Allocating only moves a pointer forward and deallocating does nothing. All
+ * memory is given back at once by release(), which makes the arena a good fit
+ * for many short-lived objects with a common lifetime, e.g. a single request.
+ */
+class monotonic_arena {
+  private: // Classes
+    /**
+     * @brief Header in front of every block.
+     */
+    struct block {
+        /**
+         * @brief The next block of the arena.
+         */
+        block *next;
+
+        /**
+         * @brief The data size of the block.
+         */
+        std::size_t size;
+    };
+
+  private: // Static members
+    /**
+     * @brief The size of the block header, keeping the block data maximally
+     *        aligned.
+     */
+    static const constexpr std::size_t s_header_size{(sizeof(block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)};
+
+  private: // Member variables
+    /**
+     * @brief The data size of regular blocks.
+     *
+     * Grows if a single request needed more than one block.
+     */
+    std::size_t m_block_size;
+
+    /**
+     * @brief All blocks of the arena.
+     *
+     * The first block is the regular block memory is currently taken from.
+     * Blocks for allocations larger than the block size are added behind it.
+     */
+    block *m_blocks;
+
+    /**
+     * @brief The first free byte in the current block.
+     *
+     * If no regular block was allocated yet, the pointer is nullptr.
+     */
+    unsigned char *m_current;
+
+    /**
+     * @brief The end of the current block.
+     */
+    unsigned char *m_end;
+
+    /**
+     * @brief The amount of blocks requested from the global allocation
+     *        function.
+     */
+    std::size_t m_block_count;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an empty arena.
+     *
+     * No memory is allocated before the first allocation.
+     *
+     * @param _block_size The data size of regular blocks.
+     */
+    explicit monotonic_arena(const std::size_t &_block_size = 64 * 1024);
+
+    /**
+     * @brief The allocated memory is owned by the arena, so it can not be
+     *        copied.
+     */
+    monotonic_arena(const monotonic_arena &_other) = delete;
+
+    /**
+     * @brief Free all blocks.
+     */
+    ~monotonic_arena();
+
+  public: // Getter
+    /**
+     * @brief Returns the amount of blocks requested from the global
+     *        allocation function since the arena was created.
+     *
+     * @return The amount of allocated blocks.
+     */
+    std::size_t block_count() const;
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory, which stays valid until release() is called.
+     *
+     * @param _size The size of the memory in bytes.
+     * @param _alignment The alignment of the memory, which is a power of two.
+     * @return Pointer to the allocated memory.
+     */
+    void *allocate(const std::size_t &_size, const std::size_t &_alignment);
+
+    /**
+     * @brief Releases all allocated memory at once.
+     *
+     * If all memory was taken from a single block, the block is kept, so the
+     * next request does not have to allocate again. Otherwise the blocks are
+     * freed and replaced by a single block of their combined size once memory
+     * is requested again.
+     */
+    void release();
+
+  private: // Functionality
+    /**
+     * @brief Allocates a new block with the given data size.
+     *
+     * @param _size The data size of the block.
+     * @return The new block.
+     */
+    block *allocate_block(const std::size_t &_size);
+
+  private: // Static functionality
+    /**
+     * @brief Returns the data of a block.
+     */
+    static unsigned char *data(block *_block);
+
+    /**
+     * @brief Aligns a pointer up to the given alignment.
+     */
+    static unsigned char *align(unsigned char *_pointer, const std::size_t &_alignment);
+
+  public: // Operators
+    /**
+     * @brief The allocated memory is owned by the arena, so it can not be
+     *        assigned.
+     */
+    monotonic_arena &operator=(const monotonic_arena &_other) = delete;
+};
+
+/**
+ * @brief Allocator taking its memory from a monotonic arena.
+ *
+ * All copies refer to the same arena, which has to outlive every container
+ * using the allocator.
+ */
+template <typename _content_type>
+class arena_allocator {
+  public: // Typedefs
+    /**
+     * @brief The type of the allocated values.
+     */
+    typedef _content_type value_type;
+
+  private: // Member variables
+    /**
+     * @brief The arena the memory is taken from.
+     */
+    monotonic_arena *m_arena;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an allocator taking its memory from the given arena.
+     *
+     * @param _arena The arena the memory is taken from.
+     */
+    arena_allocator(monotonic_arena &_arena)
+        : m_arena{&_arena}
+    {
+    }
+
+    /**
+     * @brief Rebinding constructor.
+     */
+    template <typename _other_content_type>
+    arena_allocator(const arena_allocator<_other_content_type> &_other)
+        : m_arena{&_other.arena()}
+    {
+    }
+
+  public: // Getter
+    /**
+     * @brief Returns the arena the memory is taken from.
+     */
+    monotonic_arena &arena() const
+    {
+        return *m_arena;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory for the given amount of values.
+     */
+    value_type *allocate(const std::size_t &_count)
+    {
+        if (_count > SIZE_MAX / sizeof(value_type)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<value_type *>(m_arena->allocate(_count * sizeof(value_type), alignof(value_type)));
+    }
+
+    /**
+     * @brief Memory is only released with the whole arena.
+     */
+    void deallocate(value_type *, const std::size_t &)
+    {
+    }
+
+  public: // Operators
+    /**
+     * @brief Allocators are equal if they use the same arena.
+     */
+    template <typename _other_content_type>
+    bool operator==(const arena_allocator<_other_content_type> &_other) const
+    {
+        return m_arena == &_other.arena();
+    }
+
+    /**
+     * @brief Allocators are unequal if they use different arenas.
+     */
+    template <typename _other_content_type>
+    bool operator!=(const arena_allocator<_other_content_type> &_other) const
+    {
+        return !(*this == _other);
+    }
+};
+
+#endif // ARENA_HPP_
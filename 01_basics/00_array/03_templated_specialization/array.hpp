@@ -5,23 +5,95 @@
 #define ARRAY_HPP_
 
 #include <climits>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
+#include "array_expression.hpp"
+
+/**
+ * @brief The default amount of values saved inside an array object.
+ *
+ * As many values as fit in 32 bytes are saved inline, e.g. eight int or four
+ * double values. Types larger than 32 bytes are always saved on the heap.
+ */
 template <typename _content_type>
+inline constexpr std::size_t default_inline_capacity{32 / sizeof(_content_type)};
+
+/**
+ * @brief A class implementing a templated dynamic array.
+ *
+ * All memory is requested from the allocator through std::allocator_traits,
+ * so the array can e.g. live in an arena or a pool. Arrays with at most
+ * _inline_capacity values are saved inside the array object and never
+ * allocate. Growing arrays reserve additional capacity geometrically, so
+ * appending values one by one only reallocates a logarithmic amount of
+ * times.
+ *
+ * All functions are constexpr, so arrays using std::allocator can be built
+ * during constant evaluation, e.g. to compute lookup tables at compile time.
+ * Such arrays can not outlive the evaluation and are never saved inline.
+ */
+template <typename _content_type, typename _allocator_type = std::allocator<_content_type>, std::size_t _inline_capacity = default_inline_capacity<_content_type>>
 class array {
   public: // Typedefs
+    /**
+     * @brief The content_type saved in this array
+     */
     typedef _content_type content_type;
 
+    /**
+     * @brief The allocator used for the internal data representation.
+     */
+    typedef _allocator_type allocator_type;
+
+  private: // Typedefs
+    typedef std::allocator_traits<allocator_type> allocator_traits;
+
+  public: // Static members
+    /**
+     * @brief The maximal amount of values saved inside the array object.
+     */
+    static const constexpr std::size_t inline_capacity{_inline_capacity};
+
+  private: // Static members
+    /**
+     * @brief The factor the capacity is multiplied with when the array grows.
+     */
+    static const constexpr std::size_t s_growth_factor{2};
+
   private: // Member variables
+    /**
+     * @brief The allocator used for the internal data representation.
+     */
+    allocator_type m_allocator;
+
+    /**
+     * @brief Memory for the values if the size does not exceed the inline
+     *        capacity.
+     */
+    alignas(content_type) unsigned char m_inline_data[inline_capacity > 0 ? inline_capacity * sizeof(content_type) : 1];
+
     /**
      * @brief Size of the array
      */
     std::size_t m_size;
 
+    /**
+     * @brief The amount of values the memory can hold.
+     *
+     * The capacity is equal to the inline capacity while the values are
+     * saved inline.
+     */
+    std::size_t m_capacity;
+
     /**
      * @brief Pointer to the start of the array
      *
-     * If size is zero, the pointer is invalid.
+     * If the capacity does not exceed the inline capacity, the pointer points
+     * to the inline memory.
      */
     content_type *m_data;
 
@@ -30,23 +102,37 @@ class array {
      * @brief Creates an array of a given size.
      *
      * @param _size The size of the array.
+     * @param _allocator The allocator used for the internal data
+     *                   representation.
      */
-    array(const std::size_t &_size);
+    constexpr array(const std::size_t &_size, const allocator_type &_allocator = allocator_type{});
+
+    /**
+     * @brief Creates an array from the values of an element-wise expression.
+     *
+     * @param _expression The expression that is evaluated.
+     * @param _allocator The allocator used for the internal data
+     *                   representation.
+     */
+    template <array_expression _expression_type>
+    constexpr array(const _expression_type &_expression, const allocator_type &_allocator = allocator_type{});
 
     /**
      * @brief Copy constructor.
      */
-    array(const array<content_type> &_other);
+    constexpr array(const array<content_type, allocator_type, _inline_capacity> &_other);
 
     /**
      * @brief Move constructor.
+     *
+     * Inline values are moved one by one, heap memory is taken over.
      */
-    array(array<content_type> &&_other);
+    constexpr array(array<content_type, allocator_type, _inline_capacity> &&_other);
 
     /**
      * @brief Free array memory if used.
      */
-    ~array();
+    constexpr ~array();
 
   public: // Getter
     /**
@@ -54,18 +140,185 @@ class array {
      *
      * @return The array size.
      */
-    std::size_t size() const;
+    constexpr std::size_t size() const;
+
+    /**
+     * @brief Returns the amount of values the array can hold without
+     *        reallocating.
+     *
+     * @return The array capacity.
+     */
+    constexpr std::size_t capacity() const;
+
+    /**
+     * @brief Returns the allocator used for the internal data representation.
+     *
+     * @return A copy of the allocator.
+     */
+    constexpr allocator_type get_allocator() const;
+
+    /**
+     * @brief Returns a pointer to the values.
+     */
+    constexpr content_type *data();
+
+    /**
+     * @brief Returns a constant pointer to the values.
+     */
+    constexpr const content_type *data() const;
 
   public: // Functionality
     /**
      * @brief Resizes the array to the new array size.
      *
-     * Frees the previously allocated memory if needed and copies as much old
-     * values as possible to the new array.
+     * The memory is only reallocated if the new size exceeds the capacity, in
+     * which case the capacity grows geometrically. New values are value
+     * initialized.
      *
      * @param _size The size of the array.
      */
-    void resize(const std::size_t &_size);
+    constexpr void resize(const std::size_t &_size);
+
+    /**
+     * @brief Resizes the array without initializing new values.
+     *
+     * Meant for buffers of trivial values, which are overwritten anyway. The
+     * new values are indeterminate until they are assigned.
+     *
+     * @param _size The size of the array.
+     */
+    constexpr void resize_uninitialized(const std::size_t &_size)
+        requires std::is_trivially_default_constructible_v<_content_type> && std::is_trivially_destructible_v<_content_type>;
+
+    /**
+     * @brief Ensures that the array can hold a given amount of values without
+     *        reallocating.
+     *
+     * @param _capacity The minimal capacity of the array.
+     */
+    constexpr void reserve(const std::size_t &_capacity);
+
+    /**
+     * @brief Frees unused capacity.
+     *
+     * Moves the values back into the array object if they fit inline.
+     */
+    constexpr void shrink_to_fit();
+
+    /**
+     * @brief Appends a copy of a value.
+     *
+     * @param _value The appended value, which might be a value of this array.
+     */
+    constexpr void push_back(const content_type &_value);
+
+    /**
+     * @brief Appends a value by moving it.
+     *
+     * @param _value The appended value.
+     */
+    constexpr void push_back(content_type &&_value);
+
+    /**
+     * @brief Appends a value constructed from the given arguments.
+     *
+     * @param _arguments The arguments passed to the constructor.
+     * @return Reference to the new value.
+     */
+    template <typename... _argument_types>
+    constexpr content_type &emplace_back(_argument_types &&..._arguments);
+
+  private: // Functionality
+    /**
+     * @brief Returns the amount of values saved inside the array object.
+     *
+     * The inline memory can not be reinterpreted as values during constant
+     * evaluation, so all values are allocated there.
+     */
+    static constexpr std::size_t usable_inline_capacity();
+
+    /**
+     * @brief Returns the inline memory, which is nullptr during constant
+     *        evaluation.
+     */
+    constexpr content_type *inline_data();
+
+    /**
+     * @brief Returns the capacity after growing to hold at least a given
+     *        amount of values.
+     *
+     * @param _size The amount of values the array has to hold.
+     */
+    constexpr std::size_t grown_capacity(const std::size_t &_size) const;
+
+    /**
+     * @brief Moves the values to memory with a new capacity.
+     *
+     * @param _capacity The new capacity, which has to fit all values.
+     */
+    constexpr void reallocate(const std::size_t &_capacity);
+
+    /**
+     * @brief Relocates the values to uninitialized memory.
+     *
+     * Trivially copyable values are copied at once outside of constant
+     * evaluation, all other values are moved one by one if moving can not
+     * throw and copied otherwise. The values stay untouched if an exception
+     * is thrown.
+     *
+     * @param _destination The uninitialized memory.
+     */
+    constexpr void relocate_values(content_type *_destination);
+
+    /**
+     * @brief Frees the memory if it is not inline, without destroying values.
+     */
+    constexpr void deallocate_data();
+
+    /**
+     * @brief Allocates memory and constructs the values of an array.
+     *
+     * If the size does not exceed the inline capacity, the values are
+     * constructed in the inline memory, which has to be unused.
+     *
+     * @param _allocator The allocator used for the memory.
+     * @param _size The size of the new array.
+     * @param _source Iterator to the values the first values are constructed
+     *                from.
+     * @param _source_size The amount of values constructed from the source.
+     *                     The remaining values are value initialized.
+     * @return Pointer to the new values.
+     */
+    template <typename _iterator_type>
+    constexpr content_type *create_values(allocator_type &_allocator, const std::size_t &_size, _iterator_type _source, const std::size_t &_source_size);
+
+    /**
+     * @brief Constructs values in uninitialized memory.
+     *
+     * Already constructed values are destroyed again if an exception is
+     * thrown.
+     *
+     * @param _allocator The allocator used for the memory.
+     * @param _data The uninitialized memory.
+     * @param _size The amount of constructed values.
+     * @param _source Iterator to the values the first values are constructed
+     *                from.
+     * @param _source_size The amount of values constructed from the source.
+     *                     The remaining values are value initialized.
+     */
+    template <typename _iterator_type>
+    static constexpr void construct_values(allocator_type &_allocator, content_type *_data, const std::size_t &_size, _iterator_type _source, const std::size_t &_source_size);
+
+    /**
+     * @brief Destroys the values of an array and frees its memory if it is
+     *        not inline.
+     *
+     * @param _allocator The allocator used for the memory.
+     * @param _data Pointer to the values.
+     * @param _size The size of the array.
+     * @param _capacity The capacity of the array.
+     */
+    static constexpr void destroy_values(allocator_type &_allocator, content_type *_data, const std::size_t &_size, const std::size_t &_capacity);
 
   public: // Operators
     /**
@@ -77,7 +330,7 @@ class array {
      * @param _index The index that should be accessed.
      * @return Reference to the value at the given index.
      */
-    content_type &operator[](const std::size_t &_index);
+    constexpr content_type &operator[](const std::size_t &_index);
 
     /**
      * @brief Get a constant reference to the value at a given index.
@@ -88,31 +341,79 @@ class array {
      * @param _index The index that should be accessed.
      * @return Constant reference to the value at the given index.
      */
-    const content_type &operator[](const std::size_t &_index) const;
+    constexpr const content_type &operator[](const std::size_t &_index) const;
 
     /**
      * @brief Assignment operator.
      */
-    array &operator=(const array<content_type> &_other);
+    constexpr array &operator=(const array<content_type, allocator_type, _inline_capacity> &_other);
+
+    /**
+     * @brief Evaluates an element-wise expression in a single loop.
+     *
+     * No temporary array is created if the size of the expression matches
+     * the size of the array. The expression might refer to this array, as
+     * every value only depends on the values at the same index.
+     *
+     * @param _expression The expression that is evaluated.
+     * @return Reference to this array.
+     */
+    template <array_expression _expression_type>
+    constexpr array &operator=(const _expression_type &_expression);
 
     /**
      * @brief Move operator.
+     *
+     * The values are moved one by one if they are inline or if the
+     * allocators are not equal and the allocator is not propagated.
      */
-    array &operator=(array<content_type> &&_other);
+    constexpr array &operator=(array<content_type, allocator_type, _inline_capacity> &&_other);
 };
 
 /**
  * @brief Specified array class for bool values.
+ *
+ * The inline capacity is ignored, as the values are packed into words.
+ *
+ * Like the standard containers, constant functions may be called by several
+ * threads at once, while all other functions require exclusive access to the
+ * array. Additionally, operator[] and words() can be used by several threads
+ * at once, as long as the threads change values in different words. The only
+ * state they share is the validity of the rank index, which they drop with
+ * an atomic store.
+ *
+ * rank() and select() use an index, which is dropped by every change of the
+ * values. The non-constant overloads build it again when needed, the
+ * constant overloads never change the array and count the words themselves
+ * if the index is not valid. build_rank_index() builds the index up front,
+ * e.g. before the array is queried by several threads.
  */
-template <>
-class array<bool> {
+template <typename _allocator_type, std::size_t _inline_capacity>
+class array<bool, _allocator_type, _inline_capacity> {
   public: // Typedefs
     typedef bool content_type;
 
+    /**
+     * @brief The type of the words the values are packed into.
+     */
+    typedef std::uint64_t word_type;
+
+    /**
+     * @brief The allocator type, which is rebound for the internal data
+     *        representation.
+     */
+    typedef _allocator_type allocator_type;
+
   private: // Typedefs
-    typedef unsigned char    underlying_type;
+    typedef word_type        underlying_type;
     typedef underlying_type *underlying_array_type;
 
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<underlying_type> underlying_allocator_type;
+    typedef std::allocator_traits<underlying_allocator_type>                                     underlying_allocator_traits;
+
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<std::uint16_t> block_rank_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<std::size_t>   size_allocator_type;
+
   public: // inner class
     /**
      * @brief Wrapper used to get and set bool values saved as bitfields.
@@ -127,12 +428,20 @@ class array<bool> {
         /**
          * @brief The mask that can be used to access the bit.
          */
-        const array<bool>::underlying_type m_mask;
+        const underlying_type m_mask;
 
         /**
          * @brief The raw array data.
          */
-        array<bool>::underlying_array_type m_data;
+        underlying_array_type m_data;
+
+        /**
+         * @brief The validity of the rank index, which is dropped when the
+         *        value changes.
+         *
+         * nullptr for values of constant arrays, which can not be changed.
+         */
+        bool *m_rank_index_valid;
 
       private: // Constructor
         /**
@@ -142,33 +451,146 @@ class array<bool> {
          *               specified bit.
          * @param _mask The mask that can be used to access the bit.
          * @param _data The raw array data.
+         * @param _rank_index_valid The validity of the rank index.
          */
-        bool_wrapper(const std::size_t                        &_index,
-                     const array<bool>::underlying_type       &_mask,
-                     const array<bool>::underlying_array_type &_data);
+        constexpr bool_wrapper(const std::size_t           &_index,
+                               const underlying_type       &_mask,
+                               const underlying_array_type &_data,
+                               bool                        *_rank_index_valid);
 
       public: // Operators
         /**
          * @brief Implicit converter to bool.
          */
-        bool_wrapper &operator=(const bool &_value);
+        constexpr bool_wrapper &operator=(const bool &_value);
 
         /**
          * @brief Implicit converter to bool.
          */
-        operator bool() const;
+        constexpr operator bool() const;
 
       private: // Friends
-        friend array<bool>;
+        friend array<bool, allocator_type, _inline_capacity>;
+    };
+
+  private: // Classes
+    /**
+     * @brief The rank index, which is allocated by the first
+     *        build_rank_index().
+     */
+    struct rank_index {
+        /**
+         * @brief The amount of true values in front of each superblock.
+         */
+        std::vector<std::size_t, size_allocator_type> superblock_ranks;
+
+        /**
+         * @brief The amount of true values in front of each block relative to
+         *        its superblock.
+         *
+         * The index costs 16 bits per 512 bits, so about 3 % of extra memory.
+         */
+        std::vector<std::uint16_t, block_rank_allocator_type> block_ranks;
+
+        /**
+         * @brief The block containing every s_select_sample_rate-th true
+         *        value.
+         */
+        std::vector<std::size_t, size_allocator_type> select_samples;
+
+        /**
+         * @brief The amount of true values when the index was built.
+         */
+        std::size_t count;
+
+        /**
+         * @brief Creates an empty index.
+         *
+         * @param _allocator The allocator the vectors are rebound from.
+         */
+        explicit constexpr rank_index(const underlying_allocator_type &_allocator);
     };
 
+  private: // Typedefs
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<rank_index> rank_index_allocator_type;
+    typedef std::allocator_traits<rank_index_allocator_type>                                 rank_index_allocator_traits;
+
   private: // Static members
     static const constexpr std::size_t s_underlying_type_bit_size{CHAR_BIT * sizeof(underlying_type)};
 
+    /**
+     * @brief The amount of words in a block of the rank index, which fills a
+     *        cache line.
+     */
+    static const constexpr std::size_t s_block_word_size{8};
+
+    /**
+     * @brief The amount of bits in a block of the rank index.
+     */
+    static const constexpr std::size_t s_block_bit_size{s_block_word_size * s_underlying_type_bit_size};
+
+    /**
+     * @brief The amount of blocks in a superblock of the rank index.
+     *
+     * The rank of a block relative to its superblock has to fit in 16 bits.
+     */
+    static const constexpr std::size_t s_superblock_block_size{128};
+
+    /**
+     * @brief The amount of true values between two select samples.
+     */
+    static const constexpr std::size_t s_select_sample_rate{4096};
+
   private: // Static functionality
-    static underlying_array_type allocate_for_bits(const std::size_t &_bits, std::size_t &_array_size);
+    static constexpr underlying_array_type allocate_for_bits(underlying_allocator_type &_allocator, const std::size_t &_bits, std::size_t &_array_size);
+
+    /**
+     * @brief Returns the mask of the bits used in the last word of an array.
+     *
+     * @param _size The amount of stored bool values.
+     * @return The mask of the used bits.
+     */
+    static constexpr underlying_type last_word_mask(const std::size_t &_size);
+
+    /**
+     * @brief Drops the rank index after values were changed.
+     *
+     * Uses an atomic store at runtime, as values in different words may be
+     * changed by several threads at once.
+     *
+     * @param _rank_index_valid The validity of the rank index.
+     */
+    static constexpr void drop_rank_index(bool &_rank_index_valid);
+
+  private: // Functionality
+    /**
+     * @brief Frees the rank index.
+     */
+    constexpr void release_rank_index();
+
+    /**
+     * @brief Takes over the rank index of another array.
+     *
+     * The rank index of this array has to be released.
+     *
+     * @param _other The other array, whose rank index is reset.
+     */
+    constexpr void take_rank_index(array<bool, allocator_type, _inline_capacity> &_other);
+
+    /**
+     * @brief Returns the amount of true values in front of a block.
+     *
+     * @param _block The index of the block.
+     * @return The rank of the first bit of the block.
+     */
+    constexpr std::size_t block_rank(const std::size_t &_block) const;
 
   private: // Member variables
+    /**
+     * @brief The allocator used for the internal data representation.
+     */
+    underlying_allocator_type m_allocator;
+
     /**
      * @brief Amount of stored bool values
      */
@@ -176,41 +598,60 @@ class array<bool> {
 
     /**
      * @brief Size of the internal array
-     *
-     * If size is zero, the value is invalid.
      */
     std::size_t m_array_size;
 
     /**
      * @brief Pointer to the start of the array
      *
-     * If size is zero, the pointer is invalid. Instead of using a bool array
-     * a char array is used, to maximize data density.
+     * If size is zero, the pointer is nullptr. Instead of using a bool array
+     * an array of 64 bit words is used, to maximize data density and to
+     * process whole words at once. Bits behind the last value are always
+     * zero.
      */
     underlying_array_type m_data;
 
+    /**
+     * @brief Whether the rank index is used by rank() and select().
+     *
+     * Set by build_rank_index() and reset by all functions changing values.
+     * Changes of single values reset it through drop_rank_index(), as they
+     * may happen concurrently.
+     */
+    bool m_rank_index_valid;
+
+    /**
+     * @brief The rank index, which is nullptr until it is built.
+     *
+     * The memory is kept when the index is dropped, so it can be reused when
+     * the index is built again.
+     */
+    rank_index *m_rank_index;
+
   public: // Constructors and destructor
     /**
      * @brief Creates an array of a given size.
      *
      * @param _size The size of the array.
+     * @param _allocator The allocator used for the internal data
+     *                   representation.
      */
-    array(const std::size_t &_size);
+    constexpr array(const std::size_t &_size, const allocator_type &_allocator = allocator_type{});
 
     /**
      * @brief Copy constructor.
      */
-    array(const array<bool> &_other);
+    constexpr array(const array<bool, allocator_type, _inline_capacity> &_other);
 
     /**
      * @brief Move constructor.
      */
-    array(array<bool> &&_other);
+    constexpr array(array<bool, allocator_type, _inline_capacity> &&_other);
 
     /**
      * @brief Free array memory if used.
      */
-    ~array();
+    constexpr ~array();
 
   public: // Getter
     /**
@@ -218,14 +659,123 @@ class array<bool> {
      *
      * @return The array size.
      */
-    std::size_t size() const;
+    constexpr std::size_t size() const;
 
     /**
      * @brief Returns the amount of bits used to save the boolean array.
      *
      * @return The bits used to save the data.
      */
-    std::size_t used_bits() const;
+    constexpr std::size_t used_bits() const;
+
+    /**
+     * @brief Returns the amount of words the values are packed into.
+     *
+     * @return The word count.
+     */
+    constexpr std::size_t word_count() const;
+
+    /**
+     * @brief Returns a pointer to the words the values are packed into.
+     *
+     * Value i is bit i % 64 of word i / 64. Bits behind the last value have
+     * to stay zero. Drops the rank index, as the words might be changed.
+     *
+     * @return Pointer to the words.
+     */
+    constexpr word_type *words();
+
+    /**
+     * @brief Returns a constant pointer to the words the values are packed
+     *        into.
+     *
+     * @return Pointer to the words.
+     */
+    constexpr const word_type *words() const;
+
+    /**
+     * @brief Returns the allocator used for the internal data representation.
+     *
+     * @return A copy of the allocator.
+     */
+    constexpr allocator_type get_allocator() const;
+
+    /**
+     * @brief Returns the amount of true values.
+     *
+     * @return The population count of the whole array.
+     */
+    constexpr std::size_t count() const;
+
+    /**
+     * @brief Checks whether any value is true.
+     */
+    constexpr bool any() const;
+
+    /**
+     * @brief Checks whether all values are false.
+     */
+    constexpr bool none() const;
+
+    /**
+     * @brief Returns the index of the first true value.
+     *
+     * @return The index or size() if all values are false.
+     */
+    constexpr std::size_t find_first() const;
+
+    /**
+     * @brief Returns the index of the first true value behind a given index.
+     *
+     * @param _index The index after which the search starts.
+     * @return The index or size() if all following values are false.
+     */
+    constexpr std::size_t find_next(const std::size_t &_index) const;
+
+    /**
+     * @brief Returns the amount of true values in front of a given index.
+     *
+     * Runs in constant time if the rank index was built, otherwise all words
+     * in front of the index are counted.
+     *
+     * @param _index The index, which is at most size().
+     * @return The amount of true values at indices smaller than the index.
+     */
+    constexpr std::size_t rank(const std::size_t &_index) const;
+
+    /**
+     * @brief Returns the amount of true values in front of a given index.
+     *
+     * Builds the rank index first if it is not valid, so repeated calls on
+     * unchanged values run in constant time.
+     *
+     * @param _index The index, which is at most size().
+     * @return The amount of true values at indices smaller than the index.
+     */
+    constexpr std::size_t rank(const std::size_t &_index);
+
+    /**
+     * @brief Returns the index of the true value with a given rank.
+     *
+     * Starts at a sampled block and scans the following blocks, which is
+     * nearly constant time if the rank index was built. Otherwise all words
+     * are scanned from the start.
+     *
+     * @param _rank The rank of the true value, starting at zero.
+     * @return The index or size() if there are not enough true values.
+     */
+    constexpr std::size_t select(const std::size_t &_rank) const;
+
+    /**
+     * @brief Returns the index of the true value with a given rank.
+     *
+     * Builds the rank index first if it is not valid, so repeated calls on
+     * unchanged values run in nearly constant time.
+     *
+     * @param _rank The rank of the true value, starting at zero.
+     * @return The index or size() if there are not enough true values.
+     */
+    constexpr std::size_t select(const std::size_t &_rank);
 
   public: // Functionality
     /**
@@ -236,7 +786,20 @@ class array<bool> {
      *
      * @param _size The size of the array.
      */
-    void resize(const std::size_t &_size);
+    constexpr void resize(const std::size_t &_size);
+
+    /**
+     * @brief Inverts all values in place.
+     */
+    constexpr void flip();
+
+    /**
+     * @brief Builds the index used by rank() and select() for the current
+     *        values.
+     *
+     * The memory of a previous index is reused.
+     */
+    constexpr void build_rank_index();
 
   public: // Operators
     /**
@@ -248,7 +811,7 @@ class array<bool> {
      * @param _index The index that should be accessed.
      * @return Reference to the value at the given index.
      */
-    bool_wrapper operator[](const std::size_t &_index);
+    constexpr bool_wrapper operator[](const std::size_t &_index);
 
     /**
      * @brief Get a constant reference to the value at a given index.
@@ -259,17 +822,55 @@ class array<bool> {
      * @param _index The index that should be accessed.
      * @return Constant reference to the value at the given index.
      */
-    const bool_wrapper operator[](const std::size_t &_index) const;
+    constexpr const bool_wrapper operator[](const std::size_t &_index) const;
+
+    /**
+     * @brief Combines the values with the values of another array using and.
+     *
+     * Both arrays are required to have the same size.
+     *
+     * @param _other The other array.
+     * @return Reference to this array.
+     */
+    constexpr array &operator&=(const array<bool, allocator_type, _inline_capacity> &_other);
+
+    /**
+     * @brief Combines the values with the values of another array using or.
+     *
+     * Both arrays are required to have the same size.
+     *
+     * @param _other The other array.
+     * @return Reference to this array.
+     */
+    constexpr array &operator|=(const array<bool, allocator_type, _inline_capacity> &_other);
+
+    /**
+     * @brief Combines the values with the values of another array using
+     *        exclusive or.
+     *
+     * Both arrays are required to have the same size.
+     *
+     * @param _other The other array.
+     * @return Reference to this array.
+     */
+    constexpr array &operator^=(const array<bool, allocator_type, _inline_capacity> &_other);
+
+    /**
+     * @brief Returns a copy with all values inverted.
+     *
+     * Use flip() to invert the values in place.
+     */
+    constexpr array operator~() const;
 
     /**
      * @brief Assignment operator.
      */
-    array &operator=(const array<content_type> &_other);
+    constexpr array &operator=(const array<bool, allocator_type, _inline_capacity> &_other);
 
     /**
      * @brief Move operator.
      */
-    array &operator=(array<content_type> &&_other);
+    constexpr array &operator=(array<bool, allocator_type, _inline_capacity> &&_other);
 
   private: // Friends
     friend bool_wrapper;
@@ -277,4 +878,4 @@ class array<bool> {
 
 #include "array.tpp"
 
-#endif // ARRAY_HPP_
\ No newline at end of file
+#endif // ARRAY_HPP_
@@ -2,132 +2,439 @@
 // SPDX-License-Identifier: MIT
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstring>
+#include <iterator>
+#include <utility>
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity>::array(const std::size_t &_size, const allocator_type &_allocator)
+    : m_allocator{_allocator},
+      m_size{_size},
+      m_capacity{std::max(_size, usable_inline_capacity())},
+      m_data{create_values(m_allocator, _size, static_cast<const content_type *>(nullptr), 0)}
+{
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+template <array_expression _expression_type>
+constexpr array<_content_type, _allocator_type, _inline_capacity>::array(const _expression_type &_expression, const allocator_type &_allocator)
+    : array(_expression.size(), _allocator)
+{
+    *this = _expression;
+}
 
-template <typename _content_type>
-array<_content_type>::array(const std::size_t &_size)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity>::array(const array<_content_type, _allocator_type, _inline_capacity> &_other)
+    : m_allocator{allocator_traits::select_on_container_copy_construction(_other.m_allocator)},
+      m_size{_other.m_size},
+      m_capacity{std::max(_other.m_size, usable_inline_capacity())},
+      m_data{create_values(m_allocator, _other.m_size, static_cast<const content_type *>(_other.m_data), _other.m_size)}
 {
-    if (_size > 0) {
-        m_size = _size;
-        m_data = new content_type[m_size];
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity>::array(array<_content_type, _allocator_type, _inline_capacity> &&_other)
+    : m_allocator{std::move(_other.m_allocator)},
+      m_size{_other.m_size},
+      m_capacity{usable_inline_capacity()},
+      m_data{inline_data()}
+{
+    if (_other.m_capacity > usable_inline_capacity()) {
+        m_data     = std::exchange(_other.m_data, _other.inline_data());
+        m_capacity = std::exchange(_other.m_capacity, usable_inline_capacity());
     } else {
-        m_size = 0;
+        _other.relocate_values(m_data);
     }
+
+    _other.m_size = 0;
 }
 
-template <typename _content_type>
-array<_content_type>::array(const array<_content_type> &_other)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity>::~array()
 {
-    if (_other.m_size > 0) {
-        m_size = _other.m_size;
-        m_data = new content_type[m_size];
+    destroy_values(m_allocator, m_data, m_size, m_capacity);
+}
 
-        std::memcpy(m_data, _other.m_data, m_size * sizeof(content_type));
-    } else {
-        m_size = 0;
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<_content_type, _allocator_type, _inline_capacity>::size() const
+{
+    return m_size;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<_content_type, _allocator_type, _inline_capacity>::capacity() const
+{
+    return m_capacity;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr _allocator_type array<_content_type, _allocator_type, _inline_capacity>::get_allocator() const
+{
+    return m_allocator;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr _content_type *array<_content_type, _allocator_type, _inline_capacity>::data()
+{
+    return m_data;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr const _content_type *array<_content_type, _allocator_type, _inline_capacity>::data() const
+{
+    return m_data;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::resize(const std::size_t &_size)
+{
+    if (_size > m_capacity) {
+        reallocate(grown_capacity(_size));
+    }
+
+    for (; m_size > _size; --m_size) {
+        allocator_traits::destroy(m_allocator, m_data + m_size - 1);
+    }
+
+    for (; m_size < _size; ++m_size) {
+        allocator_traits::construct(m_allocator, m_data + m_size);
     }
 }
 
-template <typename _content_type>
-array<_content_type>::array(array<_content_type> &&_other)
-    : m_size{_other.m_size},
-      m_data{_other.m_data}
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::resize_uninitialized(const std::size_t &_size)
+    requires std::is_trivially_default_constructible_v<_content_type> && std::is_trivially_destructible_v<_content_type>
 {
-    _other.m_size = 0;
+    if (_size > m_capacity) {
+        reallocate(grown_capacity(_size));
+    }
+
+    m_size = _size;
 }
 
-template <typename _content_type>
-array<_content_type>::~array()
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::reserve(const std::size_t &_capacity)
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    if (_capacity > m_capacity) {
+        reallocate(_capacity);
     }
 }
 
-template <typename _content_type>
-std::size_t array<_content_type>::size() const
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::shrink_to_fit()
 {
-    return m_size;
+    if (m_capacity > std::max(m_size, usable_inline_capacity())) {
+        reallocate(m_size);
+    }
 }
 
-template <typename _content_type>
-void array<_content_type>::resize(const std::size_t &_size)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::push_back(const content_type &_value)
 {
-    const bool    delete_old_data{m_size > 0};
-    content_type *old_data{m_data};
+    emplace_back(_value);
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::push_back(content_type &&_value)
+{
+    emplace_back(std::move(_value));
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+template <typename... _argument_types>
+constexpr _content_type &array<_content_type, _allocator_type, _inline_capacity>::emplace_back(_argument_types &&..._arguments)
+{
+    if (m_size < m_capacity) {
+        allocator_traits::construct(m_allocator, m_data + m_size, std::forward<_argument_types>(_arguments)...);
+
+        return m_data[m_size++];
+    }
+
+    // The new value is constructed before the old values are relocated, as
+    // the arguments might refer to them.
+    const std::size_t   capacity{grown_capacity(m_size + 1)};
+    content_type *const data{allocator_traits::allocate(m_allocator, capacity)};
+
+    try {
+        allocator_traits::construct(m_allocator, data + m_size, std::forward<_argument_types>(_arguments)...);
+    } catch (...) {
+        allocator_traits::deallocate(m_allocator, data, capacity);
+        throw;
+    }
+
+    try {
+        relocate_values(data);
+    } catch (...) {
+        allocator_traits::destroy(m_allocator, data + m_size);
+        allocator_traits::deallocate(m_allocator, data, capacity);
+        throw;
+    }
+
+    deallocate_data();
+
+    m_data     = data;
+    m_capacity = capacity;
+
+    return m_data[m_size++];
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<_content_type, _allocator_type, _inline_capacity>::usable_inline_capacity()
+{
+    return std::is_constant_evaluated() ? 0 : inline_capacity;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr _content_type *array<_content_type, _allocator_type, _inline_capacity>::inline_data()
+{
+    if (std::is_constant_evaluated()) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<content_type *>(m_inline_data);
+}
 
-    if (_size > 0) {
-        m_data = new content_type[m_size];
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<_content_type, _allocator_type, _inline_capacity>::grown_capacity(const std::size_t &_size) const
+{
+    return std::max(_size, m_capacity * s_growth_factor);
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::reallocate(const std::size_t &_capacity)
+{
+    content_type *const data{_capacity > usable_inline_capacity() ? allocator_traits::allocate(m_allocator, _capacity) : inline_data()};
 
-        const std::size_t byte_size{std::min(m_size, _size) * sizeof(content_type)};
-        if (byte_size > 0) {
-            std::memcpy(m_data, old_data, byte_size);
+    try {
+        relocate_values(data);
+    } catch (...) {
+        if (_capacity > usable_inline_capacity()) {
+            allocator_traits::deallocate(m_allocator, data, _capacity);
         }
 
-        m_size = _size;
+        throw;
+    }
+
+    deallocate_data();
+
+    m_data     = data;
+    m_capacity = std::max(_capacity, usable_inline_capacity());
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::relocate_values(content_type *_destination)
+{
+    if constexpr (std::is_trivially_copyable_v<content_type>) {
+        // Values can not be copied as bytes during constant evaluation.
+        if (!std::is_constant_evaluated()) {
+            if (m_size > 0) {
+                std::memcpy(static_cast<void *>(_destination), static_cast<const void *>(m_data), m_size * sizeof(content_type));
+            }
+
+            return;
+        }
+    }
+
+    if constexpr (std::is_nothrow_move_constructible_v<content_type> || !std::is_copy_constructible_v<content_type>) {
+        construct_values(m_allocator, _destination, m_size, std::make_move_iterator(m_data), m_size);
     } else {
-        m_size = 0;
+        construct_values(m_allocator, _destination, m_size, static_cast<const content_type *>(m_data), m_size);
     }
 
-    if (delete_old_data) {
-        delete[] old_data;
+    for (std::size_t i{0}; i < m_size; ++i) {
+        allocator_traits::destroy(m_allocator, m_data + i);
     }
 }
 
-template <typename _content_type>
-_content_type &array<_content_type>::operator[](const std::size_t &_index)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::deallocate_data()
+{
+    if (m_capacity > usable_inline_capacity()) {
+        allocator_traits::deallocate(m_allocator, m_data, m_capacity);
+    }
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+template <typename _iterator_type>
+constexpr _content_type *array<_content_type, _allocator_type, _inline_capacity>::create_values(allocator_type &_allocator, const std::size_t &_size, _iterator_type _source, const std::size_t &_source_size)
+{
+    content_type *const ret{_size > usable_inline_capacity() ? allocator_traits::allocate(_allocator, _size) : inline_data()};
+
+    try {
+        construct_values(_allocator, ret, _size, _source, _source_size);
+    } catch (...) {
+        if (_size > usable_inline_capacity()) {
+            allocator_traits::deallocate(_allocator, ret, _size);
+        }
+
+        throw;
+    }
+
+    return ret;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+template <typename _iterator_type>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::construct_values(allocator_type &_allocator, content_type *_data, const std::size_t &_size, _iterator_type _source, const std::size_t &_source_size)
+{
+    std::size_t constructed{0};
+    try {
+        for (; constructed < _source_size; ++constructed, ++_source) {
+            allocator_traits::construct(_allocator, _data + constructed, *_source);
+        }
+
+        for (; constructed < _size; ++constructed) {
+            allocator_traits::construct(_allocator, _data + constructed);
+        }
+    } catch (...) {
+        for (std::size_t i{0}; i < constructed; ++i) {
+            allocator_traits::destroy(_allocator, _data + i);
+        }
+
+        throw;
+    }
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<_content_type, _allocator_type, _inline_capacity>::destroy_values(allocator_type &_allocator, content_type *_data, const std::size_t &_size, const std::size_t &_capacity)
+{
+    for (std::size_t i{0}; i < _size; ++i) {
+        allocator_traits::destroy(_allocator, _data + i);
+    }
+
+    if (_capacity > usable_inline_capacity()) {
+        allocator_traits::deallocate(_allocator, _data, _capacity);
+    }
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr _content_type &array<_content_type, _allocator_type, _inline_capacity>::operator[](const std::size_t &_index)
 {
     return m_data[_index];
 }
 
-template <typename _content_type>
-const _content_type &array<_content_type>::operator[](const std::size_t &_index) const
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr const _content_type &array<_content_type, _allocator_type, _inline_capacity>::operator[](const std::size_t &_index) const
 {
     return m_data[_index];
 }
 
-template <typename _content_type>
-array<_content_type> &array<_content_type>::operator=(const array<content_type> &_other)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity> &array<_content_type, _allocator_type, _inline_capacity>::operator=(const array<content_type, allocator_type, _inline_capacity> &_other)
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    if (this == &_other) {
+        return *this;
+    }
+
+    if (allocator_traits::propagate_on_container_copy_assignment::value && m_allocator != _other.m_allocator) {
+        // The memory can not be freed by the new allocator.
+        destroy_values(m_allocator, m_data, m_size, m_capacity);
+
+        m_size     = 0;
+        m_capacity = usable_inline_capacity();
+        m_data     = inline_data();
+    }
+
+    if (allocator_traits::propagate_on_container_copy_assignment::value) {
+        m_allocator = _other.m_allocator;
+    }
+
+    if (_other.m_size <= m_capacity) {
+        // The memory is reused for the copies.
+        for (; m_size > 0; --m_size) {
+            allocator_traits::destroy(m_allocator, m_data + m_size - 1);
+        }
+
+        construct_values(m_allocator, m_data, _other.m_size, static_cast<const content_type *>(_other.m_data), _other.m_size);
+    } else {
+        content_type *const data{create_values(m_allocator, _other.m_size, static_cast<const content_type *>(_other.m_data), _other.m_size)};
+
+        destroy_values(m_allocator, m_data, m_size, m_capacity);
+
+        m_capacity = _other.m_size;
+        m_data     = data;
     }
 
     m_size = _other.m_size;
-    if (m_size > 0) {
-        m_data = new content_type[m_size];
 
-        std::memcpy(m_data, _other.m_data, m_size * sizeof(content_type));
+    return *this;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+template <array_expression _expression_type>
+constexpr array<_content_type, _allocator_type, _inline_capacity> &array<_content_type, _allocator_type, _inline_capacity>::operator=(const _expression_type &_expression)
+{
+    const std::size_t size{_expression.size()};
+
+    if (size != m_size) {
+        return *this = array<content_type, allocator_type, _inline_capacity>{_expression, m_allocator};
+    }
+
+    // The data pointer is copied, so the compiler knows it does not change
+    // within the loop.
+    content_type *const data{m_data};
+    for (std::size_t i{0}; i < size; ++i) {
+        data[i] = _expression[i];
     }
 
     return *this;
 }
 
-template <typename _content_type>
-array<_content_type> &array<_content_type>::operator=(array<content_type> &&_other)
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<_content_type, _allocator_type, _inline_capacity> &array<_content_type, _allocator_type, _inline_capacity>::operator=(array<content_type, allocator_type, _inline_capacity> &&_other)
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    if (this == &_other) {
+        return *this;
     }
 
-    m_size = _other.m_size;
-    m_data = _other.m_data;
+    destroy_values(m_allocator, m_data, m_size, m_capacity);
 
-    _other.m_size = 0;
+    m_size     = 0;
+    m_capacity = usable_inline_capacity();
+    m_data     = inline_data();
+
+    const bool same_allocator{allocator_traits::propagate_on_container_move_assignment::value || m_allocator == _other.m_allocator};
+
+    if (allocator_traits::propagate_on_container_move_assignment::value) {
+        m_allocator = std::move(_other.m_allocator);
+    }
+
+    if (_other.m_capacity > usable_inline_capacity() && same_allocator) {
+        m_data     = std::exchange(_other.m_data, _other.inline_data());
+        m_capacity = std::exchange(_other.m_capacity, usable_inline_capacity());
+    } else {
+        // Inline values and memory that can not be freed by this allocator
+        // are moved one by one.
+        m_data     = create_values(m_allocator, _other.m_size, std::make_move_iterator(_other.m_data), _other.m_size);
+        m_capacity = std::max(_other.m_size, usable_inline_capacity());
+
+        destroy_values(_other.m_allocator, _other.m_data, _other.m_size, _other.m_capacity);
+
+        _other.m_capacity = usable_inline_capacity();
+        _other.m_data     = _other.inline_data();
+    }
+
+    m_size = std::exchange(_other.m_size, 0);
 
     return *this;
 }
 
-array<bool>::bool_wrapper::bool_wrapper(const std::size_t           &_index,
-                                        const underlying_type       &_mask,
-                                        const underlying_array_type &_data)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::bool_wrapper::bool_wrapper(const std::size_t           &_index,
+                                                                                     const underlying_type       &_mask,
+                                                                                     const underlying_array_type &_data,
+                                                                                     bool                        *_rank_index_valid)
     : m_index{_index},
       m_mask{_mask},
-      m_data{_data}
+      m_data{_data},
+      m_rank_index_valid{_rank_index_valid}
 {
 }
 
-array<bool>::bool_wrapper &array<bool>::bool_wrapper::operator=(const bool &_value)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr typename array<bool, _allocator_type, _inline_capacity>::bool_wrapper &array<bool, _allocator_type, _inline_capacity>::bool_wrapper::operator=(const bool &_value)
 {
     if (_value) {
         m_data[m_index] |= m_mask;
@@ -135,153 +442,531 @@ array<bool>::bool_wrapper &array<bool>::bool_wrapper::operator=(const bool &_val
         m_data[m_index] &= ~(m_mask);
     }
 
+    if (m_rank_index_valid) {
+        drop_rank_index(*m_rank_index_valid);
+    }
+
     return *this;
 }
 
-array<bool>::bool_wrapper::operator bool() const
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::bool_wrapper::operator bool() const
 {
     return (m_data[m_index] & m_mask) != 0;
 }
 
-array<bool>::underlying_array_type array<bool>::allocate_for_bits(const std::size_t &_bits, std::size_t &_array_size)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::rank_index::rank_index(const underlying_allocator_type &_allocator)
+    : superblock_ranks{size_allocator_type{_allocator}},
+      block_ranks{block_rank_allocator_type{_allocator}},
+      select_samples{size_allocator_type{_allocator}},
+      count{0}
 {
-    _array_size = (_bits + s_underlying_type_bit_size - 1) / s_underlying_type_bit_size;
+}
 
-    const array<bool>::underlying_array_type ret = new underlying_type[_array_size];
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr typename array<bool, _allocator_type, _inline_capacity>::underlying_array_type array<bool, _allocator_type, _inline_capacity>::allocate_for_bits(underlying_allocator_type &_allocator, const std::size_t &_bits, std::size_t &_array_size)
+{
+    _array_size = (_bits + s_underlying_type_bit_size - 1) / s_underlying_type_bit_size;
 
-    for (std::size_t i{0}; i < _array_size; ++i) {
-        ret[0] = 0;
+    if (_array_size == 0) {
+        return nullptr;
     }
 
+    const underlying_array_type ret{underlying_allocator_traits::allocate(_allocator, _array_size)};
+
+    std::fill_n(ret, _array_size, underlying_type{0});
+
     return ret;
 }
 
-array<bool>::array(const std::size_t &_size)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr typename array<bool, _allocator_type, _inline_capacity>::underlying_type array<bool, _allocator_type, _inline_capacity>::last_word_mask(const std::size_t &_size)
 {
-    if (_size > 0) {
-        m_size = _size;
-        m_data = allocate_for_bits(_size, m_array_size);
+    const std::size_t used_bits{_size % s_underlying_type_bit_size};
+
+    return used_bits == 0 ? ~underlying_type{0} : (underlying_type{1} << used_bits) - 1;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::drop_rank_index(bool &_rank_index_valid)
+{
+    if (std::is_constant_evaluated()) {
+        _rank_index_valid = false;
     } else {
-        m_size = 0;
+        std::atomic_ref<bool>{_rank_index_valid}.store(false, std::memory_order_relaxed);
     }
 }
 
-array<bool>::array(const array<bool> &_other)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::release_rank_index()
 {
-    if (_other.m_size > 0) {
-        m_size       = _other.m_size;
-        m_array_size = _other.m_array_size;
-        m_data       = new underlying_type[m_array_size];
+    if (!m_rank_index) {
+        return;
+    }
 
-        std::memcpy(m_data, _other.m_data, m_array_size * sizeof(content_type));
-    } else {
-        m_size = 0;
+    rank_index_allocator_type allocator{m_allocator};
+    rank_index_allocator_traits::destroy(allocator, m_rank_index);
+    rank_index_allocator_traits::deallocate(allocator, m_rank_index, 1);
+
+    m_rank_index       = nullptr;
+    m_rank_index_valid = false;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::take_rank_index(array<bool, _allocator_type, _inline_capacity> &_other)
+{
+    m_rank_index       = std::exchange(_other.m_rank_index, nullptr);
+    m_rank_index_valid = std::exchange(_other.m_rank_index_valid, false);
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::block_rank(const std::size_t &_block) const
+{
+    return m_rank_index->superblock_ranks[_block / s_superblock_block_size] + m_rank_index->block_ranks[_block];
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::array(const std::size_t &_size, const allocator_type &_allocator)
+    : m_allocator{_allocator},
+      m_size{_size},
+      m_array_size{0},
+      m_data{allocate_for_bits(m_allocator, _size, m_array_size)},
+      m_rank_index_valid{false},
+      m_rank_index{nullptr}
+{
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::array(const array<bool, _allocator_type, _inline_capacity> &_other)
+    : m_allocator{underlying_allocator_traits::select_on_container_copy_construction(_other.m_allocator)},
+      m_size{_other.m_size},
+      m_array_size{0},
+      m_data{allocate_for_bits(m_allocator, _other.m_size, m_array_size)},
+      m_rank_index_valid{false},
+      m_rank_index{nullptr}
+{
+    if (m_array_size > 0) {
+        std::copy_n(_other.m_data, m_array_size, m_data);
     }
 }
 
-array<bool>::array(array<bool> &&_other)
-    : m_size{_other.m_size},
-      m_array_size{_other.m_array_size},
-      m_data{_other.m_data}
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::array(array<bool, _allocator_type, _inline_capacity> &&_other)
+    : m_allocator{std::move(_other.m_allocator)},
+      m_size{std::exchange(_other.m_size, 0)},
+      m_array_size{std::exchange(_other.m_array_size, 0)},
+      m_data{std::exchange(_other.m_data, nullptr)},
+      m_rank_index_valid{false},
+      m_rank_index{nullptr}
 {
-    _other.m_size = 0;
+    take_rank_index(_other);
 }
 
-array<bool>::~array()
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity>::~array()
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
     }
+
+    release_rank_index();
 }
 
-std::size_t array<bool>::size() const
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::size() const
 {
     return m_size;
 }
 
-std::size_t array<bool>::used_bits() const
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::used_bits() const
 {
     return m_array_size * s_underlying_type_bit_size;
 }
 
-void array<bool>::resize(const std::size_t &_size)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::word_count() const
 {
-    const bool            delete_old_data{m_size > 0};
-    underlying_array_type old_data{m_data};
+    return m_array_size;
+}
 
-    m_size = _size;
-    if (m_size > 0) {
-        const std::size_t old_array_size{m_array_size};
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr typename array<bool, _allocator_type, _inline_capacity>::word_type *array<bool, _allocator_type, _inline_capacity>::words()
+{
+    drop_rank_index(m_rank_index_valid);
+
+    return m_data;
+}
 
-        m_data = allocate_for_bits(_size, m_array_size);
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr const typename array<bool, _allocator_type, _inline_capacity>::word_type *array<bool, _allocator_type, _inline_capacity>::words() const
+{
+    return m_data;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr _allocator_type array<bool, _allocator_type, _inline_capacity>::get_allocator() const
+{
+    return allocator_type{m_allocator};
+}
 
-        const std::size_t byte_size{std::min(m_array_size, old_array_size) * sizeof(underlying_array_type)};
-        if (byte_size > 0) {
-            std::memcpy(m_data, old_data, byte_size);
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::count() const
+{
+    std::size_t ret{0};
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        ret += static_cast<std::size_t>(std::popcount(m_data[i]));
+    }
+
+    return ret;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr bool array<bool, _allocator_type, _inline_capacity>::any() const
+{
+    underlying_type combined{0};
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        combined |= m_data[i];
+    }
+
+    return combined != 0;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr bool array<bool, _allocator_type, _inline_capacity>::none() const
+{
+    return !any();
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::find_first() const
+{
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        if (m_data[i] != 0) {
+            return i * s_underlying_type_bit_size + static_cast<std::size_t>(std::countr_zero(m_data[i]));
         }
+    }
+
+    return m_size;
+}
 
-        for (std::size_t i{byte_size}; i < m_array_size; ++i) {
-            m_data[i] = 0;
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::find_next(const std::size_t &_index) const
+{
+    const std::size_t start{_index + 1};
+    if (start >= m_size) {
+        return m_size;
+    }
+
+    std::size_t index{start / s_underlying_type_bit_size};
+
+    // Ignore the bits in front of the start in the first word.
+    underlying_type word{m_data[index] & (~underlying_type{0} << (start % s_underlying_type_bit_size))};
+
+    while (word == 0) {
+        if (++index == m_array_size) {
+            return m_size;
+        }
+
+        word = m_data[index];
+    }
+
+    return index * s_underlying_type_bit_size + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::rank(const std::size_t &_index) const
+{
+    const std::size_t word{_index / s_underlying_type_bit_size};
+    const std::size_t offset{_index % s_underlying_type_bit_size};
+
+    std::size_t ret{0};
+    std::size_t first_word{0};
+    if (m_rank_index_valid) {
+        const std::size_t block{_index / s_block_bit_size};
+
+        ret        = block_rank(block);
+        first_word = block * s_block_word_size;
+    }
+
+    for (std::size_t i{first_word}; i < word; ++i) {
+        ret += static_cast<std::size_t>(std::popcount(m_data[i]));
+    }
+
+    if (offset > 0) {
+        ret += static_cast<std::size_t>(std::popcount(m_data[word] & ((underlying_type{1} << offset) - 1)));
+    }
+
+    return ret;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::rank(const std::size_t &_index)
+{
+    if (!m_rank_index_valid) {
+        build_rank_index();
+    }
+
+    return std::as_const(*this).rank(_index);
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::select(const std::size_t &_rank) const
+{
+    std::size_t remaining{_rank};
+    std::size_t word{0};
+    if (m_rank_index_valid) {
+        if (_rank >= m_rank_index->count) {
+            return m_size;
         }
+
+        std::size_t block{m_rank_index->select_samples[_rank / s_select_sample_rate]};
+        while (block + 1 < m_rank_index->block_ranks.size() && block_rank(block + 1) <= _rank) {
+            ++block;
+        }
+
+        remaining -= block_rank(block);
+        word = block * s_block_word_size;
     }
 
-    if (delete_old_data) {
-        delete[] old_data;
+    for (; word < m_array_size; ++word) {
+        const std::size_t count{static_cast<std::size_t>(std::popcount(m_data[word]))};
+        if (remaining < count) {
+            // Drop the lower true values of the word.
+            underlying_type value{m_data[word]};
+            for (; remaining > 0; --remaining) {
+                value &= value - 1;
+            }
+
+            return word * s_underlying_type_bit_size + static_cast<std::size_t>(std::countr_zero(value));
+        }
+
+        remaining -= count;
     }
+
+    return m_size;
 }
 
-array<bool>::bool_wrapper array<bool>::operator[](const std::size_t &_index)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr std::size_t array<bool, _allocator_type, _inline_capacity>::select(const std::size_t &_rank)
+{
+    if (!m_rank_index_valid) {
+        build_rank_index();
+    }
+
+    return std::as_const(*this).select(_rank);
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::resize(const std::size_t &_size)
+{
+    std::size_t                 array_size{0};
+    const underlying_array_type data{allocate_for_bits(m_allocator, _size, array_size)};
+
+    const std::size_t copied_size{std::min(m_array_size, array_size)};
+    if (copied_size > 0) {
+        std::copy_n(m_data, copied_size, data);
+
+        // Bits behind the new size have to be false if the array grows again.
+        data[array_size - 1] &= last_word_mask(_size);
+    }
+
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
+    }
+
+    m_size             = _size;
+    m_array_size       = array_size;
+    m_data             = data;
+    m_rank_index_valid = false;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::flip()
+{
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        m_data[i] = ~m_data[i];
+    }
+
+    if (m_array_size > 0) {
+        m_data[m_array_size - 1] &= last_word_mask(m_size);
+    }
+
+    m_rank_index_valid = false;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr void array<bool, _allocator_type, _inline_capacity>::build_rank_index()
+{
+    if (!m_rank_index) {
+        rank_index_allocator_type allocator{m_allocator};
+        rank_index *const         index{rank_index_allocator_traits::allocate(allocator, 1)};
+
+        try {
+            rank_index_allocator_traits::construct(allocator, index, m_allocator);
+        } catch (...) {
+            rank_index_allocator_traits::deallocate(allocator, index, 1);
+            throw;
+        }
+
+        m_rank_index = index;
+    }
+
+    // One more block than needed, so the rank of size() can be looked up.
+    const std::size_t block_count{m_array_size / s_block_word_size + 1};
+
+    m_rank_index->superblock_ranks.resize((block_count + s_superblock_block_size - 1) / s_superblock_block_size);
+    m_rank_index->block_ranks.resize(block_count);
+    m_rank_index->select_samples.clear();
+
+    std::size_t total{0};
+    for (std::size_t block{0}; block < block_count; ++block) {
+        const std::size_t superblock{block / s_superblock_block_size};
+        if (block % s_superblock_block_size == 0) {
+            m_rank_index->superblock_ranks[superblock] = total;
+        }
+
+        m_rank_index->block_ranks[block] = static_cast<std::uint16_t>(total - m_rank_index->superblock_ranks[superblock]);
+
+        const std::size_t end{std::min((block + 1) * s_block_word_size, m_array_size)};
+        for (std::size_t word{block * s_block_word_size}; word < end; ++word) {
+            total += static_cast<std::size_t>(std::popcount(m_data[word]));
+        }
+
+        while (m_rank_index->select_samples.size() * s_select_sample_rate < total) {
+            m_rank_index->select_samples.push_back(block);
+        }
+    }
+
+    m_rank_index->count = total;
+    m_rank_index_valid  = true;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr typename array<bool, _allocator_type, _inline_capacity>::bool_wrapper array<bool, _allocator_type, _inline_capacity>::operator[](const std::size_t &_index)
 {
     const std::size_t     index{_index / s_underlying_type_bit_size};
     const std::size_t     offset{_index - index * s_underlying_type_bit_size};
-    const underlying_type mask{static_cast<underlying_type>(1u << offset)};
+    const underlying_type mask{static_cast<underlying_type>(underlying_type{1} << offset)};
 
-    return array<bool>::bool_wrapper{
+    return bool_wrapper{
         index,
         mask,
-        m_data};
+        m_data,
+        &m_rank_index_valid};
 }
 
-const array<bool>::bool_wrapper array<bool>::operator[](const std::size_t &_index) const
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr const typename array<bool, _allocator_type, _inline_capacity>::bool_wrapper array<bool, _allocator_type, _inline_capacity>::operator[](const std::size_t &_index) const
 {
     const std::size_t     index{_index / s_underlying_type_bit_size};
     const std::size_t     offset{_index - index * s_underlying_type_bit_size};
-    const underlying_type mask{static_cast<underlying_type>(1u << offset)};
+    const underlying_type mask{static_cast<underlying_type>(underlying_type{1} << offset)};
 
-    return array<bool>::bool_wrapper{
-        _index / s_underlying_type_bit_size,
+    return bool_wrapper{
+        index,
         mask,
-        m_data};
+        m_data,
+        nullptr};
 }
 
-array<bool> &array<bool>::operator=(const array<bool> &_other)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> &array<bool, _allocator_type, _inline_capacity>::operator&=(const array<bool, _allocator_type, _inline_capacity> &_other)
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        m_data[i] &= _other.m_data[i];
     }
 
-    m_size = _other.m_size;
-    if (m_size > 0) {
-        m_array_size = _other.m_array_size;
-        m_data       = new underlying_type[m_array_size];
+    m_rank_index_valid = false;
 
-        std::memcpy(m_data, _other.m_data, m_array_size * sizeof(content_type));
+    return *this;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> &array<bool, _allocator_type, _inline_capacity>::operator|=(const array<bool, _allocator_type, _inline_capacity> &_other)
+{
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        m_data[i] |= _other.m_data[i];
     }
 
+    m_rank_index_valid = false;
+
     return *this;
 }
 
-array<bool> &array<bool>::operator=(array<bool> &&_other)
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> &array<bool, _allocator_type, _inline_capacity>::operator^=(const array<bool, _allocator_type, _inline_capacity> &_other)
 {
-    if (m_size > 0) {
-        delete[] m_data;
+    for (std::size_t i{0}; i < m_array_size; ++i) {
+        m_data[i] ^= _other.m_data[i];
     }
 
-    m_size       = _other.m_size;
-    m_array_size = _other.m_array_size;
-    m_data       = _other.m_data;
+    m_rank_index_valid = false;
 
-    _other.m_size = 0;
+    return *this;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> array<bool, _allocator_type, _inline_capacity>::operator~() const
+{
+    array<bool, allocator_type, _inline_capacity> ret{*this};
+    ret.flip();
+
+    return ret;
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> &array<bool, _allocator_type, _inline_capacity>::operator=(const array<bool, _allocator_type, _inline_capacity> &_other)
+{
+    if (this != &_other) {
+        array<bool, allocator_type, _inline_capacity> copy{_other.m_size, underlying_allocator_traits::propagate_on_container_copy_assignment::value ? _other.get_allocator() : get_allocator()};
+
+        if (copy.m_array_size > 0) {
+            std::copy_n(_other.m_data, copy.m_array_size, copy.m_data);
+        }
+
+        // The rank index is freed before the allocator might be replaced.
+        release_rank_index();
+
+        std::swap(m_allocator, copy.m_allocator);
+        std::swap(m_size, copy.m_size);
+        std::swap(m_array_size, copy.m_array_size);
+        std::swap(m_data, copy.m_data);
+
+        m_rank_index_valid = false;
+    }
 
     return *this;
-}
\ No newline at end of file
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+constexpr array<bool, _allocator_type, _inline_capacity> &array<bool, _allocator_type, _inline_capacity>::operator=(array<bool, _allocator_type, _inline_capacity> &&_other)
+{
+    if (this == &_other) {
+        return *this;
+    }
+
+    if (!underlying_allocator_traits::propagate_on_container_move_assignment::value && !(m_allocator == _other.m_allocator)) {
+        // The memory of the other array can not be freed by this allocator.
+        return *this = static_cast<const array<bool, allocator_type, _inline_capacity> &>(_other);
+    }
+
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
+    }
+
+    release_rank_index();
+
+    if (underlying_allocator_traits::propagate_on_container_move_assignment::value) {
+        m_allocator = std::move(_other.m_allocator);
+    }
+
+    m_size       = std::exchange(_other.m_size, 0);
+    m_array_size = std::exchange(_other.m_array_size, 0);
+    m_data       = std::exchange(_other.m_data, nullptr);
+
+    take_rank_index(_other);
+
+    return *this;
+}
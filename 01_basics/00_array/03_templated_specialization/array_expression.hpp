@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef ARRAY_EXPRESSION_HPP_
+#define ARRAY_EXPRESSION_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+class array;
+
+/**
+ * @brief Base class of all lazily evaluated element-wise array expressions.
+ *
+ * An expression only saves its operands and computes a single value when it
+ * is indexed. Assigning it to an array evaluates the whole expression in a
+ * single loop without temporary arrays. Expressions refer to the data of the
+ * arrays they were created from, so they are meant to be evaluated within the
+ * same statement.
+ */
+class array_expression_base {
+};
+
+/**
+ * @brief Checks whether a type is an array of values.
+ *
+ * Arrays of bool values are excluded, as their values are packed bits.
+ */
+template <typename _type>
+struct is_value_array : std::false_type {
+};
+
+/**
+ * @brief Checks whether a type is an array of values.
+ */
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+struct is_value_array<array<_content_type, _allocator_type, _inline_capacity>> : std::bool_constant<!std::is_same_v<_content_type, bool>> {
+};
+
+/**
+ * @brief A concept, which ensures that a type is a lazily evaluated array
+ *        expression.
+ */
+template <typename T>
+concept array_expression = std::derived_from<T, array_expression_base>;
+
+/**
+ * @brief A concept, which ensures that a type provides element-wise values,
+ *        either as an array or as an expression.
+ */
+template <typename T>
+concept array_operand = array_expression<T> || is_value_array<T>::value;
+
+/**
+ * @brief A concept, which ensures that a type can be used as an argument of an
+ *        element-wise operation.
+ *
+ * Arithmetic values are broadcast to every element.
+ */
+template <typename T>
+concept array_argument = array_operand<T> || std::is_arithmetic_v<T>;
+
+/**
+ * @brief A concept, which ensures that an element-wise operation is called
+ *        with at least one array operand.
+ */
+template <typename... T>
+concept array_arguments = (array_argument<T> && ...) && (array_operand<T> || ...);
+
+/**
+ * @brief Expression leaf referring to the data of an array.
+ */
+template <typename _content_type>
+class array_terminal : public array_expression_base {
+  private: // Member variables
+    /**
+     * @brief The data of the array.
+     */
+    const _content_type *m_data;
+
+    /**
+     * @brief The size of the array.
+     */
+    std::size_t m_size;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates a leaf referring to the given data.
+     *
+     * @param _data The data of the array.
+     * @param _size The size of the array.
+     */
+    constexpr array_terminal(const _content_type *_data, const std::size_t &_size)
+        : m_data{_data},
+          m_size{_size}
+    {
+    }
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     */
+    constexpr std::size_t size() const
+    {
+        return m_size;
+    }
+
+  public: // Operators
+    /**
+     * @brief Returns the value at a given index.
+     */
+    constexpr const _content_type &operator[](const std::size_t &_index) const
+    {
+        return m_data[_index];
+    }
+};
+
+/**
+ * @brief Expression leaf broadcasting a scalar to every element.
+ */
+template <typename _content_type>
+class array_scalar : public array_expression_base {
+  private: // Member variables
+    /**
+     * @brief The broadcast value.
+     */
+    _content_type m_value;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates a leaf broadcasting the given value.
+     *
+     * @param _value The broadcast value.
+     */
+    explicit constexpr array_scalar(const _content_type &_value)
+        : m_value{_value}
+    {
+    }
+
+  public: // Getter
+    /**
+     * @brief A scalar fits arrays of every size, so it does not add to the
+     *        size of an expression.
+     */
+    constexpr std::size_t size() const
+    {
+        return 0;
+    }
+
+  public: // Operators
+    /**
+     * @brief Returns the broadcast value.
+     */
+    constexpr const _content_type &operator[](const std::size_t &) const
+    {
+        return m_value;
+    }
+};
+
+/**
+ * @brief Checks whether an expression leaf is a broadcast scalar.
+ */
+template <typename _type>
+struct is_array_scalar : std::false_type {
+};
+
+/**
+ * @brief Checks whether an expression leaf is a broadcast scalar.
+ */
+template <typename _content_type>
+struct is_array_scalar<array_scalar<_content_type>> : std::true_type {
+};
+
+/**
+ * @brief Expression applying an operation to the elements of its operands.
+ *
+ * All operands with a size are required to have the same size.
+ */
+template <typename _operation_type, typename... _operand_types>
+class array_function_expression : public array_expression_base {
+  private: // Member variables
+    /**
+     * @brief The operation applied to every element.
+     */
+    _operation_type m_operation;
+
+    /**
+     * @brief The operands, which are expressions themselves.
+     */
+    std::tuple<_operand_types...> m_operands;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an expression applying the operation to the operands.
+     *
+     * @param _operation The operation applied to every element.
+     * @param _operands The operands.
+     */
+    explicit constexpr array_function_expression(const _operation_type &_operation, const _operand_types &..._operands)
+        : m_operation{_operation},
+          m_operands{_operands...}
+    {
+        assert(operand_sizes_match() && "All array operands of an expression are required to have the same size.");
+    }
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array operands.
+     */
+    constexpr std::size_t size() const
+    {
+        return std::apply([](const auto &..._operands) { return std::max({_operands.size()...}); }, m_operands);
+    }
+
+  public: // Operators
+    /**
+     * @brief Computes the value at a given index.
+     */
+    constexpr auto operator[](const std::size_t &_index) const
+    {
+        return std::apply([this, &_index](const auto &..._operands) { return m_operation(_operands[_index]...); }, m_operands);
+    }
+
+  private: // Functionality
+    /**
+     * @brief Checks whether all operands, which are not scalars, have the
+     *        size of the expression.
+     *
+     * Otherwise evaluating the expression would read behind the end of the
+     * smaller operands.
+     */
+    constexpr bool operand_sizes_match() const
+    {
+        const std::size_t expected{size()};
+
+        return std::apply([&expected](const auto &..._operands) { return ((is_array_scalar<std::remove_cvref_t<decltype(_operands)>>::value || _operands.size() == expected) && ...); }, m_operands);
+    }
+};
+
+/**
+ * @brief Converts an argument of an element-wise operation to an expression.
+ *
+ * @param _argument The argument, which is an expression, an array or a
+ *                  scalar.
+ * @return The argument as expression.
+ */
+template <array_argument _argument_type>
+constexpr auto as_array_expression(const _argument_type &_argument)
+{
+    if constexpr (array_expression<_argument_type>) {
+        return _argument;
+    } else if constexpr (is_value_array<_argument_type>::value) {
+        return array_terminal<typename _argument_type::content_type>{_argument.data(), _argument.size()};
+    } else {
+        return array_scalar<_argument_type>{_argument};
+    }
+}
+
+/**
+ * @brief Creates an expression applying an operation to the elements of the
+ *        arguments.
+ *
+ * @param _operation The operation applied to every element.
+ * @param _arguments The arguments, which are expressions, arrays or scalars.
+ * @return The lazily evaluated expression.
+ */
+template <typename _operation_type, array_argument... _argument_types>
+constexpr auto make_array_expression(const _operation_type &_operation, const _argument_types &..._arguments)
+{
+    return array_function_expression<_operation_type, decltype(as_array_expression(_arguments))...>{_operation, as_array_expression(_arguments)...};
+}
+
+/**
+ * @brief Element-wise square root.
+ */
+struct array_sqrt_operation {
+    template <typename _value_type>
+    auto operator()(const _value_type &_value) const
+    {
+        return std::sqrt(_value);
+    }
+};
+
+/**
+ * @brief Element-wise absolute value.
+ */
+struct array_abs_operation {
+    template <typename _value_type>
+    auto operator()(const _value_type &_value) const
+    {
+        return std::abs(_value);
+    }
+};
+
+/**
+ * @brief Element-wise fused multiply-add.
+ */
+struct array_fma_operation {
+    template <typename _first_type, typename _second_type, typename _third_type>
+    auto operator()(const _first_type &_first, const _second_type &_second, const _third_type &_third) const
+    {
+        return std::fma(_first, _second, _third);
+    }
+};
+
+/**
+ * @brief Element-wise addition.
+ */
+template <typename _left_type, typename _right_type>
+    requires array_arguments<_left_type, _right_type>
+constexpr auto operator+(const _left_type &_left, const _right_type &_right)
+{
+    return make_array_expression(std::plus<>{}, _left, _right);
+}
+
+/**
+ * @brief Element-wise subtraction.
+ */
+template <typename _left_type, typename _right_type>
+    requires array_arguments<_left_type, _right_type>
+constexpr auto operator-(const _left_type &_left, const _right_type &_right)
+{
+    return make_array_expression(std::minus<>{}, _left, _right);
+}
+
+/**
+ * @brief Element-wise multiplication.
+ */
+template <typename _left_type, typename _right_type>
+    requires array_arguments<_left_type, _right_type>
+constexpr auto operator*(const _left_type &_left, const _right_type &_right)
+{
+    return make_array_expression(std::multiplies<>{}, _left, _right);
+}
+
+/**
+ * @brief Element-wise division.
+ */
+template <typename _left_type, typename _right_type>
+    requires array_arguments<_left_type, _right_type>
+constexpr auto operator/(const _left_type &_left, const _right_type &_right)
+{
+    return make_array_expression(std::divides<>{}, _left, _right);
+}
+
+/**
+ * @brief Element-wise negation.
+ */
+template <array_operand _operand_type>
+constexpr auto operator-(const _operand_type &_operand)
+{
+    return make_array_expression(std::negate<>{}, _operand);
+}
+
+/**
+ * @brief Element-wise square root.
+ */
+template <array_operand _operand_type>
+constexpr auto sqrt(const _operand_type &_operand)
+{
+    return make_array_expression(array_sqrt_operation{}, _operand);
+}
+
+/**
+ * @brief Element-wise absolute value.
+ */
+template <array_operand _operand_type>
+constexpr auto abs(const _operand_type &_operand)
+{
+    return make_array_expression(array_abs_operation{}, _operand);
+}
+
+/**
+ * @brief Element-wise fused multiply-add, computing _first * _second + _third
+ *        with a single rounding.
+ */
+template <typename _first_type, typename _second_type, typename _third_type>
+    requires array_arguments<_first_type, _second_type, _third_type>
+constexpr auto fma(const _first_type &_first, const _second_type &_second, const _third_type &_third)
+{
+    return make_array_expression(array_fma_operation{}, _first, _second, _third);
+}
+
+#endif // ARRAY_EXPRESSION_HPP_
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "arena.hpp"
+#include "array.hpp"
+#include "counting_allocation.hpp"
+#include "pool.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of arrays living during a single request.
+ */
+static const constexpr std::size_t s_arrays_per_request{64};
+
+/**
+ * @brief The maximal size of an array.
+ */
+static const constexpr std::size_t s_max_array_size{512};
+
+/**
+ * @brief Simulates requests creating many short-lived arrays.
+ *
+ * @param _name The name of the allocation strategy.
+ * @param _requests The amount of simulated requests.
+ * @param _allocator The allocator used by all arrays.
+ * @param _end_request Called after all arrays of a request were destroyed.
+ */
+template <typename _allocator_type, typename _end_request_type>
+void benchmark_requests(const char *_name, const std::uint64_t &_requests, const _allocator_type &_allocator, _end_request_type _end_request)
+{
+    typedef array<std::uint64_t, _allocator_type> array_type;
+
+    std::vector<array_type> arrays{};
+    arrays.reserve(s_arrays_per_request);
+
+    std::uint64_t random{42};
+    std::uint64_t sum{0};
+
+    const std::uint64_t               allocations{allocation_count()};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t request{0}; request < _requests; ++request) {
+        for (std::size_t i{0}; i < s_arrays_per_request; ++i) {
+            random = random * 6364136223846793005u + 1442695040888963407u;
+
+            arrays.emplace_back(1 + (random >> 33) % s_max_array_size, _allocator);
+
+            array_type &values{arrays.back()};
+            for (std::size_t j{0}; j < values.size(); ++j) {
+                values[j] = j;
+            }
+        }
+
+        for (const array_type &values : arrays) {
+            sum += values[values.size() - 1];
+        }
+
+        arrays.clear();
+        _end_request();
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    std::cout << _name << ": "
+              << elapsed.count() / static_cast<double>(_requests) << " ns per request, "
+              << static_cast<double>(allocation_count() - allocations) / static_cast<double>(_requests) << " allocations per request (checksum " << sum << ")\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of simulated requests.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t requests{100000};
+    if (_argc > 1) {
+        requests = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    benchmark_requests("std::allocator", requests, std::allocator<std::uint64_t>{}, []() {});
+
+    monotonic_arena arena{};
+    benchmark_requests("arena_allocator", requests, arena_allocator<std::uint64_t>{arena}, [&arena]() { arena.release(); });
+
+    size_class_pool pool{};
+    benchmark_requests("pool_allocator", requests, pool_allocator<std::uint64_t>{pool}, []() {});
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "array.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Fills a bitmap with pseudo random values.
+ *
+ * @param _bitmap The bitmap that is filled.
+ * @param _seed The seed of the random values.
+ */
+void fill_random(array<bool> &_bitmap, std::uint64_t _seed)
+{
+    for (std::size_t i{0}; i < _bitmap.size(); ++i) {
+        _seed     = _seed * 6364136223846793005u + 1442695040888963407u;
+        _bitmap[i] = (_seed >> 63) != 0;
+    }
+}
+
+/**
+ * @brief Prints the result of a benchmark.
+ *
+ * @param _name The name of the benchmark.
+ * @param _count The amount of processed bits or queries.
+ * @param _unit The name of a single processed bit or query.
+ * @param _result The result, which keeps the work from being optimized away.
+ * @param _start The start of the measurement.
+ */
+void print_result(const char *_name, const std::size_t &_count, const char *_unit, const std::size_t &_result, const benchmark_clock::time_point &_start)
+{
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - _start};
+
+    std::cout << _name << ": " << elapsed.count() / static_cast<double>(_count) << " ns per " << _unit << " (result " << _result << ")\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of bits per bitmap.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t bits{1u << 26};
+    if (_argc > 1) {
+        bits = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    array<bool> first{bits};
+    array<bool> second{bits};
+
+    fill_random(first, 1);
+    fill_random(second, 2);
+
+    // Intersect and count one bit at a time through the proxy.
+    {
+        array<bool> result{bits};
+
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        std::size_t count{0};
+        for (std::size_t i{0}; i < bits; ++i) {
+            result[i] = first[i] && second[i];
+            count += result[i] ? 1 : 0;
+        }
+
+        print_result("per bit intersect and count", bits, "bit", count, start);
+    }
+
+    // Intersect and count whole words.
+    {
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        array<bool> result{first};
+        result &= second;
+
+        print_result("word intersect and count", bits, "bit", result.count(), start);
+    }
+
+    // Iterate over all true values.
+    {
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        std::size_t sum{0};
+        for (std::size_t i{first.find_first()}; i < first.size(); i = first.find_next(i)) {
+            sum += i;
+        }
+
+        print_result("find_first/find_next", bits, "bit", sum, start);
+    }
+
+    // Map random positions to dense offsets by scanning all words in front.
+    {
+        const std::size_t queries{std::min<std::size_t>(bits / 1024, 1000) + 1};
+
+        std::uint64_t random{3};
+        std::size_t   sum{0};
+
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        for (std::size_t i{0}; i < queries; ++i) {
+            random = random * 6364136223846793005u + 1442695040888963407u;
+
+            array<bool> prefix{first};
+            prefix.resize((random >> 16) % bits);
+            sum += prefix.count();
+        }
+
+        print_result("rank by counting a prefix", queries, "query", sum, start);
+    }
+
+    // Map random positions to dense offsets using the rank index.
+    {
+        const std::size_t queries{1000000};
+
+        std::uint64_t random{3};
+        std::size_t   sum{0};
+
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        first.build_rank_index();
+        for (std::size_t i{0}; i < queries; ++i) {
+            random = random * 6364136223846793005u + 1442695040888963407u;
+            sum += first.rank((random >> 16) % bits);
+        }
+
+        print_result("rank including the index build", queries, "query", sum, start);
+    }
+
+    // Map random dense offsets back to positions.
+    {
+        const std::size_t queries{1000000};
+        const std::size_t count{first.count()};
+
+        std::uint64_t random{3};
+        std::size_t   sum{0};
+
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        for (std::size_t i{0}; i < queries && count > 0; ++i) {
+            random = random * 6364136223846793005u + 1442695040888963407u;
+            sum += first.select((random >> 16) % count);
+        }
+
+        print_result("select", queries, "query", sum, start);
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "aligned_allocator.hpp"
+#include "array.hpp"
+#include "counting_allocation.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The measured arrays, aligned to a cache line without inline storage.
+ */
+typedef array<double, aligned_allocator<double>, 0> benchmark_array;
+
+/**
+ * @brief The smallest measured array size, which fits into the L1 cache.
+ */
+static const constexpr std::size_t s_min_size{std::size_t{1} << 10};
+
+/**
+ * @brief The largest measured array size, which only fits into the DRAM.
+ */
+static const constexpr std::size_t s_max_size{std::size_t{1} << 22};
+
+/**
+ * @brief Multiplies two arrays into a new array, like an operator without
+ *        expression templates would.
+ */
+benchmark_array eager_multiply(const benchmark_array &_left, const benchmark_array &_right)
+{
+    benchmark_array ret{_left.size()};
+    for (std::size_t i{0}; i < ret.size(); ++i) {
+        ret[i] = _left[i] * _right[i];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Adds two arrays into a new array, like an operator without
+ *        expression templates would.
+ */
+benchmark_array eager_add(const benchmark_array &_left, const benchmark_array &_right)
+{
+    benchmark_array ret{_left.size()};
+    for (std::size_t i{0}; i < ret.size(); ++i) {
+        ret[i] = _left[i] + _right[i];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Computes a = b * c + d with expression templates.
+ */
+void fused(benchmark_array &_a, const benchmark_array &_b, const benchmark_array &_c, const benchmark_array &_d)
+{
+    _a = _b * _c + _d;
+}
+
+/**
+ * @brief Computes a = b * c + d with a temporary array per operation.
+ */
+void eager(benchmark_array &_a, const benchmark_array &_b, const benchmark_array &_c, const benchmark_array &_d)
+{
+    _a = eager_add(eager_multiply(_b, _c), _d);
+}
+
+/**
+ * @brief Computes a = b * c + d with a hand-written loop.
+ */
+void hand_written(benchmark_array &_a, const benchmark_array &_b, const benchmark_array &_c, const benchmark_array &_d)
+{
+    double *const       a{_a.data()};
+    const double *const b{_b.data()};
+    const double *const c{_c.data()};
+    const double *const d{_d.data()};
+
+    for (std::size_t i{0}; i < _a.size(); ++i) {
+        a[i] = b[i] * c[i] + d[i];
+    }
+}
+
+/**
+ * @brief Evaluates a = b * c + d repeatedly.
+ *
+ * @param _function The evaluation strategy.
+ * @param _size The size of the arrays.
+ * @param _elements The total amount of computed elements.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @param _allocations Receives the allocations per evaluation.
+ * @return The time per element in ns.
+ */
+template <typename _function_type>
+double benchmark_size(const _function_type &_function, const std::size_t &_size, const std::uint64_t &_elements, double &_sum, double &_allocations)
+{
+    benchmark_array a{_size};
+    benchmark_array b{_size};
+    benchmark_array c{_size};
+    benchmark_array d{_size};
+
+    for (std::size_t i{0}; i < _size; ++i) {
+        b[i] = static_cast<double>(i % 7);
+        c[i] = static_cast<double>(i % 5) * 0.5;
+        d[i] = static_cast<double>(i % 3) * 0.25;
+    }
+
+    const std::uint64_t repetitions{_elements / _size > 0 ? _elements / _size : 1};
+
+    // Warm up the caches and the page tables before the measurement.
+    _function(a, b, c, d);
+
+    const std::uint64_t               allocations{allocation_count()};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t i{0}; i < repetitions; ++i) {
+        _function(a, b, c, d);
+        _sum += a[i % _size];
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    _allocations = static_cast<double>(allocation_count() - allocations) / static_cast<double>(repetitions);
+
+    return elapsed.count() / static_cast<double>(repetitions * _size);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of computed elements per size.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t elements{std::uint64_t{1} << 26};
+    if (_argc > 1) {
+        elements = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::cout << "size | KiB | fused: ns/element, allocations | eager: ns/element, allocations | hand-written: ns/element, allocations\n";
+
+    double sum{0};
+    for (std::size_t size{s_min_size}; size <= s_max_size; size *= 4) {
+        double fused_allocations{0};
+        double eager_allocations{0};
+        double hand_written_allocations{0};
+
+        const double fused_time{benchmark_size(fused, size, elements, sum, fused_allocations)};
+        const double eager_time{benchmark_size(eager, size, elements, sum, eager_allocations)};
+        const double hand_written_time{benchmark_size(hand_written, size, elements, sum, hand_written_allocations)};
+
+        std::cout << size << " | " << (4 * size * sizeof(double) / 1024)
+                  << " | " << fused_time << ", " << fused_allocations
+                  << " | " << eager_time << ", " << eager_allocations
+                  << " | " << hand_written_time << ", " << hand_written_allocations << '\n';
+    }
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "array.hpp"
+#include "counting_allocation.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The smallest measured array size.
+ */
+static const constexpr std::size_t s_min_size{16};
+
+/**
+ * @brief The largest measured array size.
+ */
+static const constexpr std::size_t s_max_size{4096};
+
+/**
+ * @brief The strategies used to fill an array.
+ */
+enum class fill_strategy {
+    /**
+     * @brief Grows the capacity by exactly one value per append, like a
+     *        resize without spare capacity.
+     */
+    exact,
+
+    /**
+     * @brief Appends with geometric capacity growth.
+     */
+    geometric,
+
+    /**
+     * @brief Reserves the final capacity before appending.
+     */
+    reserved,
+
+    /**
+     * @brief Resizes without initialization and assigns the values.
+     */
+    uninitialized
+};
+
+/**
+ * @brief Creates a value of the benchmarked type.
+ */
+template <typename _content_type>
+_content_type make_value(const std::size_t &_index)
+{
+    if constexpr (std::is_same_v<_content_type, std::string>) {
+        return std::string(32, static_cast<char>('a' + _index % 26));
+    } else {
+        return static_cast<_content_type>(_index);
+    }
+}
+
+/**
+ * @brief Fills arrays of a given size value by value.
+ *
+ * @param _strategy The strategy used to fill the arrays.
+ * @param _size The size of the arrays.
+ * @param _values The total amount of appended values.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @param _allocations Receives the array allocations per array.
+ * @return The time per value in ns.
+ */
+template <typename _content_type>
+double benchmark_size(const fill_strategy &_strategy, const std::size_t &_size, const std::uint64_t &_values, std::uint64_t &_sum, double &_allocations)
+{
+    const std::uint64_t repetitions{_values / _size > 0 ? _values / _size : 1};
+
+    // The values are created up front, so only the array is measured.
+    array<_content_type> values{_size};
+    for (std::size_t i{0}; i < _size; ++i) {
+        values[i] = make_value<_content_type>(i);
+    }
+
+    std::uint64_t                     allocations{0};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t i{0}; i < repetitions; ++i) {
+        array<_content_type, std::allocator<_content_type>, 0> filled{0};
+
+        const std::uint64_t value_allocations{std::is_same_v<_content_type, std::string> ? _size : 0};
+        const std::uint64_t allocations_before{allocation_count() + value_allocations};
+
+        if (_strategy == fill_strategy::uninitialized) {
+            if constexpr (std::is_trivial_v<_content_type>) {
+                filled.resize_uninitialized(_size);
+                for (std::size_t j{0}; j < _size; ++j) {
+                    filled[j] = values[j];
+                }
+            }
+        } else {
+            if (_strategy == fill_strategy::reserved) {
+                filled.reserve(_size);
+            }
+
+            for (std::size_t j{0}; j < _size; ++j) {
+                if (_strategy == fill_strategy::exact) {
+                    filled.reserve(j + 1);
+                }
+
+                filled.push_back(values[j]);
+            }
+        }
+
+        allocations += allocation_count() - allocations_before;
+        _sum += static_cast<std::uint64_t>(filled.size()) + static_cast<std::uint64_t>(filled.capacity());
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    _allocations = static_cast<double>(allocations) / static_cast<double>(repetitions);
+
+    return elapsed.count() / static_cast<double>(repetitions * _size);
+}
+
+/**
+ * @brief Measures all strategies for a content type.
+ *
+ * @param _content_name The name of the content type.
+ * @param _values The total amount of appended values per measurement.
+ * @param _sum Receives a checksum.
+ */
+template <typename _content_type>
+void benchmark_type(const char *_content_name, const std::uint64_t &_values, std::uint64_t &_sum)
+{
+    std::cout << _content_name << "\nsize | exact: ns/value, allocations | geometric: ns/value, allocations | reserved: ns/value, allocations";
+    if constexpr (std::is_trivial_v<_content_type>) {
+        std::cout << " | uninitialized: ns/value, allocations";
+    }
+    std::cout << '\n';
+
+    for (std::size_t size{s_min_size}; size <= s_max_size; size *= 4) {
+        std::cout << size;
+
+        for (const fill_strategy strategy : {fill_strategy::exact, fill_strategy::geometric, fill_strategy::reserved, fill_strategy::uninitialized}) {
+            if (strategy == fill_strategy::uninitialized && !std::is_trivial_v<_content_type>) {
+                continue;
+            }
+
+            double       allocations{0};
+            const double time{benchmark_size<_content_type>(strategy, size, _values, _sum, allocations)};
+
+            std::cout << " | " << time << ", " << allocations;
+        }
+
+        std::cout << '\n';
+    }
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of appended values per
+ * measurement.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t values{std::uint64_t{1} << 18};
+    if (_argc > 1) {
+        values = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::uint64_t sum{0};
+    benchmark_type<int>("int", values, sum);
+    benchmark_type<std::string>("std::string", values, sum);
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -3,10 +3,13 @@
 
 #include <iostream>
 
+#include "aligned_allocator.hpp"
+#include "arena.hpp"
 #include "array.hpp"
+#include "pool.hpp"
 
-template <typename _array_type>
-void print_array(const array<_array_type> &_arr)
+template <typename _array_type, typename _allocator_type, std::size_t _inline_capacity>
+void print_array(const array<_array_type, _allocator_type, _inline_capacity> &_arr)
 {
     std::cout << "[";
 
@@ -17,8 +20,8 @@ void print_array(const array<_array_type> &_arr)
     std::cout << " ]\n";
 }
 
-template <>
-void print_array(const array<bool> &_arr)
+template <typename _allocator_type, std::size_t _inline_capacity>
+void print_array(const array<bool, _allocator_type, _inline_capacity> &_arr)
 {
     std::cout << "[";
 
@@ -75,5 +78,109 @@ int main()
     print_array(double_arr);
     print_array(bool_arr);
 
+    // Small arrays are saved inside the object and move to the heap once
+    // they outgrow the inline capacity.
+    array<int> small_arr{3};
+    for (std::size_t i{0}; i < small_arr.size(); ++i) {
+        small_arr[i] = int_arr[i];
+    }
+
+    print_array(small_arr);
+    small_arr.resize(array<int>::inline_capacity + 1);
+    print_array(small_arr);
+    small_arr.resize(2);
+    print_array(array<int>{std::move(small_arr)});
+
+    // Appended values only reallocate when the capacity is exhausted.
+    array<int> appended_arr{0};
+    for (std::size_t i{0}; i < int_arr.size(); ++i) {
+        appended_arr.push_back(int_arr[i]);
+        std::cout << appended_arr.capacity() << ' ';
+    }
+    appended_arr.emplace_back(appended_arr[0]);
+    appended_arr.shrink_to_fit();
+    std::cout << "-> " << appended_arr.capacity() << ' ';
+    print_array(appended_arr);
+
+    // Element-wise expressions are evaluated in a single loop on assignment.
+    array<double, aligned_allocator<double>> expression_arr{double_arr.size()};
+    for (std::size_t i{0}; i < expression_arr.size(); ++i) {
+        expression_arr[i] = double_arr[i] * 2.0;
+    }
+
+    array<double> result_arr{double_arr * double_arr + 1.0};
+    print_array(result_arr);
+    result_arr = sqrt(result_arr) - abs(double_arr);
+    print_array(result_arr);
+    expression_arr = fma(expression_arr, double_arr, -expression_arr) / 2.0;
+    print_array(expression_arr);
+
+    // Whole words are combined and counted at once.
+    array<bool> mask_arr{bool_arr.size()};
+    for (std::size_t i{0}; i < mask_arr.size(); i += 2) {
+        mask_arr[i] = true;
+    }
+
+    array<bool> masked_arr{bool_arr};
+    masked_arr &= mask_arr;
+
+    print_array(masked_arr);
+    print_array(~masked_arr);
+
+    std::cout << "True values:";
+    for (std::size_t i{masked_arr.find_first()}; i < masked_arr.size(); i = masked_arr.find_next(i)) {
+        std::cout << ' ' << i;
+    }
+    std::cout << " (count " << masked_arr.count() << ", any " << masked_arr.any() << ", none " << masked_arr.none() << ")\n";
+
+    // Map positions to dense offsets of the true values and back.
+    std::cout << "Ranks:";
+    for (std::size_t i{0}; i <= bool_arr.size(); ++i) {
+        std::cout << ' ' << bool_arr.rank(i);
+    }
+    std::cout << "\nSelects:";
+    for (std::size_t i{0}; i < bool_arr.count(); ++i) {
+        std::cout << ' ' << bool_arr.select(i);
+    }
+    std::cout << '\n';
+
+    // Changing a value drops the rank index, which the next query builds again.
+    const std::size_t true_count{bool_arr.rank(bool_arr.size())};
+    bool_arr[0] = !bool_arr[0];
+    if (bool_arr.rank(bool_arr.size()) != (bool_arr[0] ? true_count + 1 : true_count - 1)) {
+        return 1;
+    }
+    bool_arr[0] = !bool_arr[0];
+
+    // All arrays of a request are taken from one arena and released at once.
+    monotonic_arena arena{};
+    {
+        array<int, arena_allocator<int>>   arena_int_arr{int_arr.size(), arena};
+        array<bool, arena_allocator<bool>> arena_bool_arr{bool_arr.size(), arena};
+
+        for (std::size_t i{0}; i < int_arr.size(); ++i) {
+            arena_int_arr[i]  = int_arr[i] * 10;
+            arena_bool_arr[i] = !bool_arr[i];
+        }
+
+        print_array(arena_int_arr);
+        print_array(arena_bool_arr);
+    }
+    arena.release();
+
+    // Freed arrays are reused by the next array of the same size class.
+    size_class_pool pool{};
+    for (std::size_t i{1}; i <= 3; ++i) {
+        array<double, pool_allocator<double>> pool_double_arr{double_arr.size(), pool};
+
+        for (std::size_t j{0}; j < double_arr.size(); ++j) {
+            pool_double_arr[j] = double_arr[j] * static_cast<double>(i);
+        }
+
+        print_array(pool_double_arr);
+    }
+
+    std::cout << "Arena blocks: " << arena.block_count() << ", pool slabs: " << pool.slab_count() << '\n';
+
     return 0;
 }
\ No newline at end of file
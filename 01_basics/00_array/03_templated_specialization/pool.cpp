@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "pool.hpp"
+
+size_class_pool::size_class_pool()
+    : m_free_lists{},
+      m_slabs{nullptr},
+      m_slab_count{0}
+{
+}
+
+size_class_pool::~size_class_pool()
+{
+    while (m_slabs) {
+        slab *const next{m_slabs->next};
+        ::operator delete(m_slabs);
+        m_slabs = next;
+    }
+}
+
+std::size_t size_class_pool::slab_count() const
+{
+    return m_slab_count;
+}
+
+void *size_class_pool::allocate(const std::size_t &_size, const std::size_t &_alignment)
+{
+    if (_alignment > alignof(std::max_align_t)) {
+        return ::operator new(_size, std::align_val_t{_alignment});
+    }
+
+    const std::size_t index{size_class(_size)};
+    if (index == s_size_class_count) {
+        return ::operator new(_size);
+    }
+
+    if (!m_free_lists[index]) {
+        refill(index);
+    }
+
+    chunk *const ret{m_free_lists[index]};
+    m_free_lists[index] = ret->next;
+
+    return ret;
+}
+
+void size_class_pool::deallocate(void *_pointer, const std::size_t &_size, const std::size_t &_alignment)
+{
+    if (_alignment > alignof(std::max_align_t)) {
+        ::operator delete(_pointer, std::align_val_t{_alignment});
+        return;
+    }
+
+    const std::size_t index{size_class(_size)};
+    if (index == s_size_class_count) {
+        ::operator delete(_pointer);
+        return;
+    }
+
+    chunk *const freed{static_cast<chunk *>(_pointer)};
+    freed->next         = m_free_lists[index];
+    m_free_lists[index] = freed;
+}
+
+void size_class_pool::refill(const std::size_t &_size_class)
+{
+    slab *const new_slab{static_cast<slab *>(::operator new(s_slab_size))};
+    new_slab->next = m_slabs;
+    m_slabs        = new_slab;
+
+    ++m_slab_count;
+
+    const std::size_t chunk_size{s_min_chunk_size << _size_class};
+    const std::size_t chunk_count{(s_slab_size - s_header_size) / chunk_size};
+
+    unsigned char *const data{reinterpret_cast<unsigned char *>(new_slab) + s_header_size};
+
+    for (std::size_t i{chunk_count}; i > 0; --i) {
+        chunk *const free_chunk{reinterpret_cast<chunk *>(data + (i - 1) * chunk_size)};
+        free_chunk->next          = m_free_lists[_size_class];
+        m_free_lists[_size_class] = free_chunk;
+    }
+}
+
+std::size_t size_class_pool::size_class(const std::size_t &_size)
+{
+    std::size_t index{0};
+    std::size_t chunk_size{s_min_chunk_size};
+
+    while (chunk_size < _size && index < s_size_class_count) {
+        chunk_size *= 2;
+        ++index;
+    }
+
+    return index;
+}
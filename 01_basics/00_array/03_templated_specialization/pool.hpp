@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef POOL_HPP_
+#define POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief A memory pool with free lists for power of two size classes.
+ *
+ * Memory of a size class is carved from large slabs and returned to the free
+ * list of its class on deallocation, so memory of short-lived objects is
+ * reused without calling the global allocation function again. Allocations
+ * larger than the largest size class are forwarded to the global allocation
+ * function.
+ */
+class size_class_pool {
+  private: // Classes
+    /**
+     * @brief A free chunk of a size class.
+     */
+    struct chunk {
+        /**
+         * @brief The next free chunk of the same size class.
+         */
+        chunk *next;
+    };
+
+    /**
+     * @brief Header in front of every slab.
+     */
+    struct slab {
+        /**
+         * @brief The next slab of the pool.
+         */
+        slab *next;
+    };
+
+  private: // Static members
+    /**
+     * @brief The size of the smallest size class.
+     */
+    static const constexpr std::size_t s_min_chunk_size{alignof(std::max_align_t)};
+
+    /**
+     * @brief The amount of size classes.
+     */
+    static const constexpr std::size_t s_size_class_count{9};
+
+    /**
+     * @brief The size of the largest size class.
+     */
+    static const constexpr std::size_t s_max_chunk_size{s_min_chunk_size << (s_size_class_count - 1)};
+
+    /**
+     * @brief The size of the slab header, keeping the chunks maximally
+     *        aligned.
+     */
+    static const constexpr std::size_t s_header_size{alignof(std::max_align_t)};
+
+    /**
+     * @brief The size of a slab including its header.
+     */
+    static const constexpr std::size_t s_slab_size{64 * 1024};
+
+    /**
+     * @brief Verify that a slab holds at least one chunk of every size class.
+     */
+    static_assert(s_header_size + s_max_chunk_size <= s_slab_size, "A slab is required to hold at least one chunk of every size class.");
+
+  private: // Member variables
+    /**
+     * @brief The free chunks of every size class.
+     */
+    chunk *m_free_lists[s_size_class_count];
+
+    /**
+     * @brief All slabs of the pool.
+     */
+    slab *m_slabs;
+
+    /**
+     * @brief The amount of slabs requested from the global allocation
+     *        function.
+     */
+    std::size_t m_slab_count;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an empty pool.
+     */
+    size_class_pool();
+
+    /**
+     * @brief The allocated memory is owned by the pool, so it can not be
+     *        copied.
+     */
+    size_class_pool(const size_class_pool &_other) = delete;
+
+    /**
+     * @brief Free all slabs.
+     */
+    ~size_class_pool();
+
+  public: // Getter
+    /**
+     * @brief Returns the amount of slabs requested from the global allocation
+     *        function since the pool was created.
+     *
+     * @return The amount of allocated slabs.
+     */
+    std::size_t slab_count() const;
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory from the free list of the matching size class.
+     *
+     * @param _size The size of the memory in bytes.
+     * @param _alignment The alignment of the memory, which is a power of two.
+     * @return Pointer to the allocated memory.
+     */
+    void *allocate(const std::size_t &_size, const std::size_t &_alignment);
+
+    /**
+     * @brief Returns memory to the free list of its size class.
+     *
+     * @param _pointer The memory returned by allocate().
+     * @param _size The size passed to allocate().
+     * @param _alignment The alignment passed to allocate().
+     */
+    void deallocate(void *_pointer, const std::size_t &_size, const std::size_t &_alignment);
+
+  private: // Functionality
+    /**
+     * @brief Carves a new slab into chunks of a size class.
+     *
+     * @param _size_class The size class whose free list is empty.
+     */
+    void refill(const std::size_t &_size_class);
+
+  private: // Static functionality
+    /**
+     * @brief Returns the size class of an allocation.
+     *
+     * @param _size The size of the allocation in bytes.
+     * @return The index of the size class or s_size_class_count if the
+     *         allocation is too large.
+     */
+    static std::size_t size_class(const std::size_t &_size);
+
+  public: // Operators
+    /**
+     * @brief The allocated memory is owned by the pool, so it can not be
+     *        assigned.
+     */
+    size_class_pool &operator=(const size_class_pool &_other) = delete;
+};
+
+/**
+ * @brief Allocator taking its memory from a size class pool.
+ *
+ * All copies refer to the same pool, which has to outlive every container
+ * using the allocator.
+ */
+template <typename _content_type>
+class pool_allocator {
+  public: // Typedefs
+    /**
+     * @brief The type of the allocated values.
+     */
+    typedef _content_type value_type;
+
+  private: // Member variables
+    /**
+     * @brief The pool the memory is taken from.
+     */
+    size_class_pool *m_pool;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an allocator taking its memory from the given pool.
+     *
+     * @param _pool The pool the memory is taken from.
+     */
+    pool_allocator(size_class_pool &_pool)
+        : m_pool{&_pool}
+    {
+    }
+
+    /**
+     * @brief Rebinding constructor.
+     */
+    template <typename _other_content_type>
+    pool_allocator(const pool_allocator<_other_content_type> &_other)
+        : m_pool{&_other.pool()}
+    {
+    }
+
+  public: // Getter
+    /**
+     * @brief Returns the pool the memory is taken from.
+     */
+    size_class_pool &pool() const
+    {
+        return *m_pool;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory for the given amount of values.
+     */
+    value_type *allocate(const std::size_t &_count)
+    {
+        if (_count > SIZE_MAX / sizeof(value_type)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<value_type *>(m_pool->allocate(_count * sizeof(value_type), alignof(value_type)));
+    }
+
+    /**
+     * @brief Returns the memory of the given amount of values to the pool.
+     */
+    void deallocate(value_type *_pointer, const std::size_t &_count)
+    {
+        m_pool->deallocate(_pointer, _count * sizeof(value_type), alignof(value_type));
+    }
+
+  public: // Operators
+    /**
+     * @brief Allocators are equal if they use the same pool.
+     */
+    template <typename _other_content_type>
+    bool operator==(const pool_allocator<_other_content_type> &_other) const
+    {
+        return m_pool == &_other.pool();
+    }
+
+    /**
+     * @brief Allocators are unequal if they use different pools.
+     */
+    template <typename _other_content_type>
+    bool operator!=(const pool_allocator<_other_content_type> &_other) const
+    {
+        return !(*this == _other);
+    }
+};
+
+#endif // POOL_HPP_
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "array.hpp"
+#include "counting_allocation.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The largest measured array size.
+ */
+static const constexpr std::size_t s_max_size{64};
+
+/**
+ * @brief Creates, fills, copies and destroys arrays of a given size.
+ *
+ * @param _size The size of the arrays.
+ * @param _count The amount of created arrays.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @param _allocations Receives the allocations per array.
+ * @return The time per array in ns.
+ */
+template <typename _array_type>
+double benchmark_size(const std::size_t &_size, const std::uint64_t &_count, std::uint64_t &_sum, double &_allocations)
+{
+    const std::uint64_t               allocations{allocation_count()};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        _array_type values{_size};
+        for (std::size_t j{0}; j < _size; ++j) {
+            values[j] = static_cast<int>(i + j);
+        }
+
+        const _array_type copy{values};
+        for (std::size_t j{0}; j < _size; ++j) {
+            _sum += static_cast<std::uint64_t>(copy[j]);
+        }
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    _allocations = static_cast<double>(allocation_count() - allocations) / static_cast<double>(_count);
+
+    return elapsed.count() / static_cast<double>(_count);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of arrays per size.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t count{100000};
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    typedef array<int, std::allocator<int>, 0>  heap_array;
+    typedef array<int>                          default_array;
+    typedef array<int, std::allocator<int>, 16> large_inline_array;
+
+    std::cout << "size | heap only: ns, allocations | inline " << default_array::inline_capacity << ": ns, allocations | inline " << large_inline_array::inline_capacity << ": ns, allocations\n";
+
+    std::uint64_t sum{0};
+    for (std::size_t size{0}; size <= s_max_size; ++size) {
+        double heap_allocations{0};
+        double default_allocations{0};
+        double large_inline_allocations{0};
+
+        const double heap_time{benchmark_size<heap_array>(size, count, sum, heap_allocations)};
+        const double default_time{benchmark_size<default_array>(size, count, sum, default_allocations)};
+        const double large_inline_time{benchmark_size<large_inline_array>(size, count, sum, large_inline_allocations)};
+
+        std::cout << size << " | " << heap_time << ", " << heap_allocations
+                  << " | " << default_time << ", " << default_allocations
+                  << " | " << large_inline_time << ", " << large_inline_allocations << '\n';
+    }
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
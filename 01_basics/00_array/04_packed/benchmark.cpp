@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "packed_array.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of values decoded at once by the block scan.
+ */
+static const constexpr std::size_t s_buffer_size{1024};
+
+/**
+ * @brief Prints a single result line.
+ *
+ * @param _name The name of the measured scan.
+ * @param _values The amount of scanned values.
+ * @param _bytes The memory footprint of the scanned values.
+ * @param _start The start of the measurement.
+ */
+void print_result(const char *_name, const std::size_t &_values, const std::size_t &_bytes, const benchmark_clock::time_point &_start)
+{
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - _start};
+
+    std::cout << "  " << _name << ": " << (elapsed.count() / static_cast<double>(_values)) << " ns/value, " << (_bytes / 1024) << " KiB\n";
+}
+
+/**
+ * @brief Sums all values of a packed array with different access methods and
+ *        compares them to a full width array.
+ *
+ * @param _size The amount of values.
+ * @param _repetitions The amount of scans per method.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ */
+template <std::size_t _bits>
+void benchmark_bits(const std::size_t &_size, const std::size_t &_repetitions, std::uint64_t &_sum)
+{
+    std::vector<std::uint32_t> full(_size);
+    packed_array<_bits>        packed{_size};
+
+    std::uint64_t state{_bits};
+    for (std::size_t i{0}; i < _size; ++i) {
+        state   = state * 6364136223846793005u + 1442695040888963407u;
+        full[i] = static_cast<std::uint32_t>(state >> 33) & ((std::uint32_t{1} << _bits) - 1);
+    }
+    packed.pack(0, _size, full.data());
+
+    std::cout << _bits << " bit values\n";
+
+    benchmark_clock::time_point start{benchmark_clock::now()};
+    for (std::size_t r{0}; r < _repetitions; ++r) {
+        for (std::size_t i{0}; i < _size; ++i) {
+            _sum += full[i];
+        }
+    }
+    print_result("full width   ", _size * _repetitions, _size * sizeof(std::uint32_t), start);
+
+    start = benchmark_clock::now();
+    for (std::size_t r{0}; r < _repetitions; ++r) {
+        const packed_array<_bits> &values{packed};
+        for (std::size_t i{0}; i < _size; ++i) {
+            _sum += values[i];
+        }
+    }
+    print_result("packed index ", _size * _repetitions, packed.used_bits() / CHAR_BIT, start);
+
+    start = benchmark_clock::now();
+    std::uint32_t buffer[s_buffer_size];
+    for (std::size_t r{0}; r < _repetitions; ++r) {
+        for (std::size_t i{0}; i < _size; i += s_buffer_size) {
+            const std::size_t count{std::min(s_buffer_size, _size - i)};
+
+            packed.unpack(i, count, buffer);
+            for (std::size_t j{0}; j < count; ++j) {
+                _sum += buffer[j];
+            }
+        }
+    }
+    print_result("packed unpack", _size * _repetitions, packed.used_bits() / CHAR_BIT, start);
+
+    start = benchmark_clock::now();
+    for (std::size_t r{0}; r < _repetitions; ++r) {
+        packed.pack(0, _size, full.data());
+    }
+    print_result("packed pack  ", _size * _repetitions, packed.used_bits() / CHAR_BIT, start);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of values per array.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t size{std::size_t{1} << 24};
+    if (_argc > 1) {
+        size = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    const std::size_t repetitions{std::max<std::size_t>((std::size_t{1} << 26) / std::max<std::size_t>(size, 1), 1)};
+
+    std::uint64_t sum{0};
+    benchmark_bits<2>(size, repetitions, sum);
+    benchmark_bits<5>(size, repetitions, sum);
+    benchmark_bits<12>(size, repetitions, sum);
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+
+#include "packed_array.hpp"
+
+template <std::size_t _bits, typename _allocator_type>
+void print_array(const packed_array<_bits, _allocator_type> &_arr)
+{
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        std::cout << ' ' << _arr[i];
+    }
+
+    std::cout << " ] : Saves " << _arr.size() << " " << _bits << " bit values in " << _arr.used_bits() << " bits instead of " << (_arr.size() * sizeof(typename packed_array<_bits, _allocator_type>::value_type) * CHAR_BIT) << " bits.\n";
+}
+
+int main()
+{
+    packed_array<2>  state_arr{11};
+    packed_array<5>  code_arr{11};
+    packed_array<12> id_arr{11};
+
+    for (std::size_t i{0}; i < state_arr.size(); ++i) {
+        state_arr[i] = static_cast<std::uint32_t>(i % 4);
+        code_arr[i]  = static_cast<std::uint32_t>(i * 3);
+        id_arr[i]    = static_cast<std::uint32_t>(i * 401);
+    }
+
+    print_array(state_arr);
+    print_array(code_arr);
+    print_array(id_arr);
+
+    // Values are truncated to their bits and might straddle two words, e.g.
+    // the sixth 12 bit value.
+    id_arr[5] = 0xABCDE;
+    id_arr[0] = id_arr[5];
+    print_array(id_arr);
+
+    // Whole blocks of 64 values are packed and unpacked at once.
+    packed_array<5> block_arr{150};
+    std::uint32_t   values[150];
+    for (std::size_t i{0}; i < block_arr.size(); ++i) {
+        values[i] = static_cast<std::uint32_t>(i);
+    }
+
+    block_arr.pack(0, block_arr.size(), values);
+    block_arr.unpack(10, 100, values);
+
+    std::cout << "Unpacked values 10 to 109:";
+    for (std::size_t i{0}; i < 100; i += 11) {
+        std::cout << ' ' << values[i];
+    }
+    std::cout << '\n';
+
+    block_arr.resize(20);
+    block_arr.resize(40);
+    print_array(block_arr);
+
+    return 0;
+}
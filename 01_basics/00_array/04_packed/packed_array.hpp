@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef PACKED_ARRAY_HPP_
+#define PACKED_ARRAY_HPP_
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief A class implementing a dynamic array of unsigned integers with a
+ *        fixed amount of bits.
+ *
+ * Generalizes the bit packing of array<bool> to values of _bits bits, e.g.
+ * 2 bit states, 5 bit codes or 12 bit ids. The values are saved back to back
+ * in 64 bit words, so a value might straddle two words. Blocks of 64 values
+ * occupy exactly _bits words and are packed and unpacked at once by unrolled
+ * kernels.
+ */
+template <std::size_t _bits, typename _allocator_type = std::allocator<std::uint32_t>>
+class packed_array {
+  public: // Typedefs
+    /**
+     * @brief The type values are read and written as.
+     */
+    typedef std::uint32_t value_type;
+
+    /**
+     * @brief The allocator type, which is rebound for the internal data
+     *        representation.
+     */
+    typedef _allocator_type allocator_type;
+
+  private: // Typedefs
+    typedef std::uint64_t    underlying_type;
+    typedef underlying_type *underlying_array_type;
+
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<underlying_type> underlying_allocator_type;
+    typedef std::allocator_traits<underlying_allocator_type>                                     underlying_allocator_traits;
+
+  public: // Static members
+    /**
+     * @brief The amount of bits per value.
+     */
+    static const constexpr std::size_t bits{_bits};
+
+    /**
+     * @brief The amount of values per block, which occupies exactly bits
+     *        words.
+     */
+    static const constexpr std::size_t block_size{64};
+
+    /**
+     * @brief Verify that a value fits into the value type.
+     */
+    static_assert(_bits > 0 && _bits <= CHAR_BIT * sizeof(value_type), "The amount of bits has to be between 1 and 32.");
+
+  private: // Static members
+    static const constexpr std::size_t s_underlying_type_bit_size{CHAR_BIT * sizeof(underlying_type)};
+
+    /**
+     * @brief The mask of the bits of a single value.
+     */
+    static const constexpr underlying_type s_value_mask{(underlying_type{1} << _bits) - 1};
+
+  public: // inner class
+    /**
+     * @brief Wrapper used to get and set values saved as bitfields.
+     */
+    class value_wrapper {
+      private: // Member variables
+        /**
+         * @brief The raw array data.
+         */
+        underlying_array_type m_data;
+
+        /**
+         * @brief The offset of the first bit of the value.
+         */
+        const std::size_t m_offset;
+
+      private: // Constructor
+        /**
+         * @brief The constructor with parameters pointing to the specified
+         *        value.
+         *
+         * @param _data The raw array data.
+         * @param _offset The offset of the first bit of the value.
+         */
+        value_wrapper(const underlying_array_type &_data, const std::size_t &_offset);
+
+      public: // Operators
+        /**
+         * @brief Sets the value, keeping only the lowest bits.
+         */
+        value_wrapper &operator=(const value_type &_value);
+
+        /**
+         * @brief Copies the value of another wrapper.
+         */
+        value_wrapper &operator=(const value_wrapper &_other);
+
+        /**
+         * @brief Implicit converter to the value type.
+         */
+        operator value_type() const;
+
+      private: // Friends
+        friend packed_array<_bits, allocator_type>;
+    };
+
+  private: // Member variables
+    /**
+     * @brief The allocator used for the internal data representation.
+     */
+    underlying_allocator_type m_allocator;
+
+    /**
+     * @brief Amount of stored values
+     */
+    std::size_t m_size;
+
+    /**
+     * @brief Size of the internal array
+     */
+    std::size_t m_array_size;
+
+    /**
+     * @brief Pointer to the start of the array
+     *
+     * If size is zero, the pointer is nullptr. Bits behind the last value are
+     * always zero.
+     */
+    underlying_array_type m_data;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an array of a given size with all values being zero.
+     *
+     * @param _size The size of the array.
+     * @param _allocator The allocator used for the internal data
+     *                   representation.
+     */
+    packed_array(const std::size_t &_size, const allocator_type &_allocator = allocator_type{});
+
+    /**
+     * @brief Copy constructor.
+     */
+    packed_array(const packed_array<_bits, allocator_type> &_other);
+
+    /**
+     * @brief Move constructor.
+     */
+    packed_array(packed_array<_bits, allocator_type> &&_other);
+
+    /**
+     * @brief Free array memory if used.
+     */
+    ~packed_array();
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     *
+     * @return The array size.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the amount of bits used to save the values.
+     *
+     * @return The bits used to save the data.
+     */
+    std::size_t used_bits() const;
+
+    /**
+     * @brief Returns the allocator used for the internal data representation.
+     *
+     * @return A copy of the allocator.
+     */
+    allocator_type get_allocator() const;
+
+  public: // Functionality
+    /**
+     * @brief Resizes the array to the new array size.
+     *
+     * Copies as much old values as possible to the new array, new values are
+     * zero.
+     *
+     * @param _size The size of the array.
+     */
+    void resize(const std::size_t &_size);
+
+    /**
+     * @brief Decodes a range of values into a buffer.
+     *
+     * Whole blocks are decoded at once, only values in front of the first and
+     * behind the last block boundary are decoded one by one.
+     *
+     * @param _first The index of the first decoded value.
+     * @param _count The amount of decoded values.
+     * @param _values The buffer receiving the values.
+     */
+    void unpack(const std::size_t &_first, const std::size_t &_count, value_type *_values) const;
+
+    /**
+     * @brief Encodes a buffer into a range of values.
+     *
+     * Only the lowest bits of every value are kept. Whole blocks are encoded
+     * at once.
+     *
+     * @param _first The index of the first encoded value.
+     * @param _count The amount of encoded values.
+     * @param _values The buffer containing the values.
+     */
+    void pack(const std::size_t &_first, const std::size_t &_count, const value_type *_values);
+
+  private: // Static functionality
+    static underlying_array_type allocate_for_values(underlying_allocator_type &_allocator, const std::size_t &_size, std::size_t &_array_size);
+
+    /**
+     * @brief Reads the value starting at a given bit offset.
+     */
+    static value_type read_value(const underlying_type *_data, const std::size_t &_offset);
+
+    /**
+     * @brief Writes the value starting at a given bit offset.
+     */
+    static void write_value(underlying_type *_data, const std::size_t &_offset, const value_type &_value);
+
+    /**
+     * @brief Decodes a whole block with shifts and masks known at compile
+     *        time.
+     *
+     * @param _words The bits words of the block.
+     * @param _values The buffer receiving the block_size values.
+     */
+    template <std::size_t... _indices>
+    static void unpack_block(const underlying_type *_words, value_type *_values, std::index_sequence<_indices...>);
+
+    /**
+     * @brief Encodes a whole block with shifts and masks known at compile
+     *        time.
+     *
+     * @param _words The bits words of the block, which are overwritten.
+     * @param _values The buffer containing the block_size values.
+     */
+    template <std::size_t... _indices>
+    static void pack_block(underlying_type *_words, const value_type *_values, std::index_sequence<_indices...>);
+
+    /**
+     * @brief Decodes the value with a given index within a block.
+     */
+    template <std::size_t _index>
+    static value_type unpack_block_value(const underlying_type *_words);
+
+    /**
+     * @brief Adds the value with a given index within a block to the zeroed
+     *        words of the block.
+     */
+    template <std::size_t _index>
+    static void pack_block_value(underlying_type *_words, const value_type &_value);
+
+  public: // Operators
+    /**
+     * @brief Get a reference to the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return Reference to the value at the given index.
+     */
+    value_wrapper operator[](const std::size_t &_index);
+
+    /**
+     * @brief Get the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return The value at the given index.
+     */
+    value_type operator[](const std::size_t &_index) const;
+
+    /**
+     * @brief Assignment operator.
+     */
+    packed_array &operator=(const packed_array<_bits, allocator_type> &_other);
+
+    /**
+     * @brief Move operator.
+     */
+    packed_array &operator=(packed_array<_bits, allocator_type> &&_other);
+};
+
+#include "packed_array.tpp"
+
+#endif // PACKED_ARRAY_HPP_
@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstring>
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::value_wrapper::value_wrapper(const underlying_array_type &_data, const std::size_t &_offset)
+    : m_data{_data},
+      m_offset{_offset}
+{
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::value_wrapper &packed_array<_bits, _allocator_type>::value_wrapper::operator=(const value_type &_value)
+{
+    write_value(m_data, m_offset, _value);
+
+    return *this;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::value_wrapper &packed_array<_bits, _allocator_type>::value_wrapper::operator=(const value_wrapper &_other)
+{
+    return *this = static_cast<value_type>(_other);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::value_wrapper::operator value_type() const
+{
+    return read_value(m_data, m_offset);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::packed_array(const std::size_t &_size, const allocator_type &_allocator)
+    : m_allocator{_allocator},
+      m_size{_size},
+      m_array_size{0},
+      m_data{allocate_for_values(m_allocator, _size, m_array_size)}
+{
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::packed_array(const packed_array<_bits, _allocator_type> &_other)
+    : m_allocator{underlying_allocator_traits::select_on_container_copy_construction(_other.m_allocator)},
+      m_size{_other.m_size},
+      m_array_size{0},
+      m_data{allocate_for_values(m_allocator, _other.m_size, m_array_size)}
+{
+    if (m_array_size > 0) {
+        std::memcpy(m_data, _other.m_data, m_array_size * sizeof(underlying_type));
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::packed_array(packed_array<_bits, _allocator_type> &&_other)
+    : m_allocator{std::move(_other.m_allocator)},
+      m_size{std::exchange(_other.m_size, 0)},
+      m_array_size{std::exchange(_other.m_array_size, 0)},
+      m_data{std::exchange(_other.m_data, nullptr)}
+{
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type>::~packed_array()
+{
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+std::size_t packed_array<_bits, _allocator_type>::size() const
+{
+    return m_size;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+std::size_t packed_array<_bits, _allocator_type>::used_bits() const
+{
+    return m_array_size * s_underlying_type_bit_size;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+_allocator_type packed_array<_bits, _allocator_type>::get_allocator() const
+{
+    return allocator_type{m_allocator};
+}
+
+template <std::size_t _bits, typename _allocator_type>
+void packed_array<_bits, _allocator_type>::resize(const std::size_t &_size)
+{
+    std::size_t                 array_size{0};
+    const underlying_array_type data{allocate_for_values(m_allocator, _size, array_size)};
+
+    const std::size_t copied_size{std::min(m_array_size, array_size)};
+    if (copied_size > 0) {
+        std::memcpy(data, m_data, copied_size * sizeof(underlying_type));
+
+        // Bits behind the new size have to be zero if the array grows again.
+        const std::size_t used_bits{(_size * _bits) % s_underlying_type_bit_size};
+        if (used_bits > 0) {
+            data[array_size - 1] &= (underlying_type{1} << used_bits) - 1;
+        }
+    }
+
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
+    }
+
+    m_size       = _size;
+    m_array_size = array_size;
+    m_data       = data;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+void packed_array<_bits, _allocator_type>::unpack(const std::size_t &_first, const std::size_t &_count, value_type *_values) const
+{
+    std::size_t i{0};
+
+    for (; i < _count && (_first + i) % block_size != 0; ++i) {
+        _values[i] = read_value(m_data, (_first + i) * _bits);
+    }
+
+    for (; i + block_size <= _count; i += block_size) {
+        unpack_block(m_data + (_first + i) / block_size * _bits, _values + i, std::make_index_sequence<block_size>{});
+    }
+
+    for (; i < _count; ++i) {
+        _values[i] = read_value(m_data, (_first + i) * _bits);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+void packed_array<_bits, _allocator_type>::pack(const std::size_t &_first, const std::size_t &_count, const value_type *_values)
+{
+    std::size_t i{0};
+
+    for (; i < _count && (_first + i) % block_size != 0; ++i) {
+        write_value(m_data, (_first + i) * _bits, _values[i]);
+    }
+
+    for (; i + block_size <= _count; i += block_size) {
+        pack_block(m_data + (_first + i) / block_size * _bits, _values + i, std::make_index_sequence<block_size>{});
+    }
+
+    for (; i < _count; ++i) {
+        write_value(m_data, (_first + i) * _bits, _values[i]);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::underlying_array_type packed_array<_bits, _allocator_type>::allocate_for_values(underlying_allocator_type &_allocator, const std::size_t &_size, std::size_t &_array_size)
+{
+    _array_size = (_size * _bits + s_underlying_type_bit_size - 1) / s_underlying_type_bit_size;
+
+    if (_array_size == 0) {
+        return nullptr;
+    }
+
+    const underlying_array_type ret{underlying_allocator_traits::allocate(_allocator, _array_size)};
+
+    std::memset(ret, 0, _array_size * sizeof(underlying_type));
+
+    return ret;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::value_type packed_array<_bits, _allocator_type>::read_value(const underlying_type *_data, const std::size_t &_offset)
+{
+    const std::size_t word{_offset / s_underlying_type_bit_size};
+    const std::size_t shift{_offset % s_underlying_type_bit_size};
+
+    underlying_type ret{_data[word] >> shift};
+
+    if (shift + _bits > s_underlying_type_bit_size) {
+        // The value straddles two words.
+        ret |= _data[word + 1] << (s_underlying_type_bit_size - shift);
+    }
+
+    return static_cast<value_type>(ret & s_value_mask);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+void packed_array<_bits, _allocator_type>::write_value(underlying_type *_data, const std::size_t &_offset, const value_type &_value)
+{
+    const std::size_t     word{_offset / s_underlying_type_bit_size};
+    const std::size_t     shift{_offset % s_underlying_type_bit_size};
+    const underlying_type value{_value & s_value_mask};
+
+    _data[word] = (_data[word] & ~(s_value_mask << shift)) | (value << shift);
+
+    if (shift + _bits > s_underlying_type_bit_size) {
+        // The value straddles two words.
+        const std::size_t high_shift{s_underlying_type_bit_size - shift};
+
+        _data[word + 1] = (_data[word + 1] & ~(s_value_mask >> high_shift)) | (value >> high_shift);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+template <std::size_t... _indices>
+void packed_array<_bits, _allocator_type>::unpack_block(const underlying_type *_words, value_type *_values, std::index_sequence<_indices...>)
+{
+    ((_values[_indices] = unpack_block_value<_indices>(_words)), ...);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+template <std::size_t... _indices>
+void packed_array<_bits, _allocator_type>::pack_block(underlying_type *_words, const value_type *_values, std::index_sequence<_indices...>)
+{
+    std::fill(_words, _words + _bits, underlying_type{0});
+
+    (pack_block_value<_indices>(_words, _values[_indices]), ...);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+template <std::size_t _index>
+typename packed_array<_bits, _allocator_type>::value_type packed_array<_bits, _allocator_type>::unpack_block_value(const underlying_type *_words)
+{
+    constexpr std::size_t word{_index * _bits / s_underlying_type_bit_size};
+    constexpr std::size_t shift{_index * _bits % s_underlying_type_bit_size};
+
+    if constexpr (shift + _bits > s_underlying_type_bit_size) {
+        return static_cast<value_type>(((_words[word] >> shift) | (_words[word + 1] << (s_underlying_type_bit_size - shift))) & s_value_mask);
+    } else {
+        return static_cast<value_type>((_words[word] >> shift) & s_value_mask);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+template <std::size_t _index>
+void packed_array<_bits, _allocator_type>::pack_block_value(underlying_type *_words, const value_type &_value)
+{
+    constexpr std::size_t word{_index * _bits / s_underlying_type_bit_size};
+    constexpr std::size_t shift{_index * _bits % s_underlying_type_bit_size};
+
+    const underlying_type value{_value & s_value_mask};
+
+    _words[word] |= value << shift;
+
+    if constexpr (shift + _bits > s_underlying_type_bit_size) {
+        _words[word + 1] |= value >> (s_underlying_type_bit_size - shift);
+    }
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::value_wrapper packed_array<_bits, _allocator_type>::operator[](const std::size_t &_index)
+{
+    return value_wrapper{m_data, _index * _bits};
+}
+
+template <std::size_t _bits, typename _allocator_type>
+typename packed_array<_bits, _allocator_type>::value_type packed_array<_bits, _allocator_type>::operator[](const std::size_t &_index) const
+{
+    return read_value(m_data, _index * _bits);
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type> &packed_array<_bits, _allocator_type>::operator=(const packed_array<_bits, _allocator_type> &_other)
+{
+    if (this != &_other) {
+        packed_array<_bits, allocator_type> copy{_other.m_size, underlying_allocator_traits::propagate_on_container_copy_assignment::value ? _other.get_allocator() : get_allocator()};
+
+        if (copy.m_array_size > 0) {
+            std::memcpy(copy.m_data, _other.m_data, copy.m_array_size * sizeof(underlying_type));
+        }
+
+        std::swap(m_allocator, copy.m_allocator);
+        std::swap(m_size, copy.m_size);
+        std::swap(m_array_size, copy.m_array_size);
+        std::swap(m_data, copy.m_data);
+    }
+
+    return *this;
+}
+
+template <std::size_t _bits, typename _allocator_type>
+packed_array<_bits, _allocator_type> &packed_array<_bits, _allocator_type>::operator=(packed_array<_bits, _allocator_type> &&_other)
+{
+    if (this == &_other) {
+        return *this;
+    }
+
+    if (!underlying_allocator_traits::propagate_on_container_move_assignment::value && !(m_allocator == _other.m_allocator)) {
+        // The memory of the other array can not be freed by this allocator.
+        return *this = static_cast<const packed_array<_bits, allocator_type> &>(_other);
+    }
+
+    if (m_data) {
+        underlying_allocator_traits::deallocate(m_allocator, m_data, m_array_size);
+    }
+
+    if (underlying_allocator_traits::propagate_on_container_move_assignment::value) {
+        m_allocator = std::move(_other.m_allocator);
+    }
+
+    m_size       = std::exchange(_other.m_size, 0);
+    m_array_size = std::exchange(_other.m_array_size, 0);
+    m_data       = std::exchange(_other.m_data, nullptr);
+
+    return *this;
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+#include "array.hpp"
+#include "mapped_array.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of measured loads per method.
+ */
+static const constexpr std::size_t s_repetitions{3};
+
+/**
+ * @brief Returns the elapsed time since a given point in ms.
+ */
+double elapsed_ms(const benchmark_clock::time_point &_start)
+{
+    return std::chrono::duration<double, std::milli>{benchmark_clock::now() - _start}.count();
+}
+
+/**
+ * @brief Sums all values, which touches every page once.
+ */
+template <typename _array_type>
+double sum_values(const _array_type &_arr)
+{
+    double ret{0};
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        ret += _arr[i];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief The main function.
+ *
+ * Compares loading a snapshot by copying it into an array with mapping it.
+ * Both files are in the page cache, so the copy is not bound by the disk.
+ * The first optional argument is the amount of values.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t size{std::size_t{1} << 24};
+    if (_argc > 1) {
+        size = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    const std::filesystem::path directory{std::filesystem::temp_directory_path()};
+    const std::string           snapshot_path{(directory / "basics_array_mapped_benchmark.raw").string()};
+    const std::string           mapped_path{(directory / "basics_array_mapped_benchmark.bin").string()};
+
+    // Write both files from the same values.
+    {
+        mapped_array<double> mapped{mapped_path, mapped_array_mode::create, size};
+
+        std::uint64_t state{1};
+        for (std::size_t i{0}; i < size; ++i) {
+            state     = state * 6364136223846793005u + 1442695040888963407u;
+            mapped[i] = static_cast<double>(state >> 40);
+        }
+        mapped.flush();
+
+        std::FILE *const file{std::fopen(snapshot_path.c_str(), "wb")};
+        if (!file || std::fwrite(mapped.data(), sizeof(double), size, file) != size) {
+            std::cerr << "Writing the snapshot failed.\n";
+            return 1;
+        }
+        std::fclose(file);
+    }
+
+    std::cout << size << " values, " << (size * sizeof(double) >> 20) << " MiB\n";
+    std::cout << "method | load ms | first scan ms | second scan ms\n";
+
+    double sum{0};
+    for (std::size_t r{0}; r < s_repetitions; ++r) {
+        benchmark_clock::time_point start{benchmark_clock::now()};
+
+        array<double> copied{0};
+        copied.resize_uninitialized(size);
+
+        std::FILE *const file{std::fopen(snapshot_path.c_str(), "rb")};
+        if (!file || std::fread(copied.data(), sizeof(double), size, file) != size) {
+            std::cerr << "Reading the snapshot failed.\n";
+            return 1;
+        }
+        std::fclose(file);
+
+        const double copy_load{elapsed_ms(start)};
+
+        start = benchmark_clock::now();
+        sum += sum_values(copied);
+        const double copy_first_scan{elapsed_ms(start)};
+
+        start = benchmark_clock::now();
+        sum += sum_values(copied);
+        const double copy_second_scan{elapsed_ms(start)};
+
+        std::cout << "copy   | " << copy_load << " | " << copy_first_scan << " | " << copy_second_scan << '\n';
+
+        start = benchmark_clock::now();
+
+        const mapped_array<const double> mapped{mapped_path, mapped_array_mode::open};
+
+        const double map_load{elapsed_ms(start)};
+
+        start = benchmark_clock::now();
+        sum += sum_values(mapped);
+        const double map_first_scan{elapsed_ms(start)};
+
+        start = benchmark_clock::now();
+        sum += sum_values(mapped);
+        const double map_second_scan{elapsed_ms(start)};
+
+        std::cout << "mapped | " << map_load << " | " << map_first_scan << " | " << map_second_scan << '\n';
+    }
+
+    std::cout << "checksum " << sum << '\n';
+
+    std::remove(snapshot_path.c_str());
+    std::remove(mapped_path.c_str());
+
+    return 0;
+}
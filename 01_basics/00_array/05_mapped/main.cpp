@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+#include "mapped_array.hpp"
+
+/**
+ * @brief Checks whether an array can be resized, which read-only arrays can
+ *        not.
+ */
+template <typename _array_type>
+concept resizable = requires(_array_type &_arr) { _arr.resize(1); };
+
+static_assert(resizable<mapped_array<int>> && !resizable<mapped_array<const int>>);
+
+template <typename _content_type>
+void print_array(const mapped_array<_content_type> &_arr)
+{
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        std::cout << ' ' << _arr[i];
+    }
+
+    std::cout << " ]\n";
+}
+
+int main()
+{
+    const std::string path{(std::filesystem::temp_directory_path() / "basics_array_mapped.bin").string()};
+
+    {
+        mapped_array<int> int_arr{path, mapped_array_mode::create, 11};
+
+        for (std::size_t i{0}; i < int_arr.size(); ++i) {
+            int_arr[i] = static_cast<int>(i) - 5;
+        }
+
+        print_array(int_arr);
+    }
+
+    // Opening the file again only maps it, the values are not copied.
+    {
+        mapped_array<int> int_arr{path, mapped_array_mode::open};
+        print_array(int_arr);
+
+        int_arr.resize(14);
+        int_arr[13] = 42;
+        int_arr.resize(15);
+        int_arr.flush();
+    }
+
+    mapped_array<int> int_arr{path, mapped_array_mode::open};
+    print_array(int_arr);
+
+    // A read-only array maps the file without write permission.
+    {
+        const mapped_array<const int> read_only_arr{path, mapped_array_mode::open};
+        print_array(read_only_arr);
+    }
+
+    try {
+        mapped_array<const int> read_only_arr{path, mapped_array_mode::create, 3};
+    } catch (const std::system_error &_error) {
+        std::cout << "Creating a read-only array failed: " << _error.what() << '\n';
+    }
+
+    // The header prevents opening the file with a different content type.
+    try {
+        mapped_array<float> float_arr{path, mapped_array_mode::open};
+    } catch (const std::system_error &_error) {
+        std::cout << "Opening as float failed: " << _error.what() << '\n';
+    }
+
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef MAPPED_ARRAY_HPP_
+#define MAPPED_ARRAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Tag identifying the content type of a mapped array file.
+ *
+ * Arithmetic types are tagged by their kind and size, e.g. a file of int32_t
+ * values can not be opened as float values. Other types have to specialize
+ * the tag with a unique non-zero value, otherwise files of two types with the
+ * same size could be mixed up.
+ */
+template <typename _content_type>
+struct mapped_array_type_tag
+    : std::integral_constant<std::uint64_t,
+                             std::is_arithmetic_v<_content_type>
+                                 ? ((std::is_floating_point_v<_content_type> ? 'f' : std::is_signed_v<_content_type> ? 'i' : 'u') << 8 | sizeof(_content_type))
+                                 : 0> {
+};
+
+/**
+ * @brief How a mapped array opens its file.
+ */
+enum class mapped_array_mode {
+    /**
+     * @brief Creates a new file or overwrites an existing one.
+     */
+    create,
+
+    /**
+     * @brief Opens an existing file, keeping its values.
+     */
+    open
+};
+
+/**
+ * @brief A class implementing a dynamic array, which is saved in a memory
+ *        mapped file.
+ *
+ * The file starts with a header containing the size and type of the values,
+ * which are saved behind it as raw bytes. Loading the array only maps the
+ * file, the values are read lazily by page faults and the page cache is
+ * shared between all processes mapping the same file. Changes are written
+ * back by the kernel, flush() waits for them.
+ *
+ * An array of const values, e.g. mapped_array<const double>, opens its file
+ * read-only and maps it without write permission. It can only open existing
+ * files and has no resize() or flush().
+ */
+template <typename _content_type>
+class mapped_array {
+  public: // Typedefs
+    /**
+     * @brief The content_type saved in this array
+     */
+    typedef _content_type content_type;
+
+    /**
+     * @brief The content type without const, which identifies the file
+     *        format.
+     */
+    typedef std::remove_const_t<content_type> value_type;
+
+    /**
+     * @brief Verify that the values can be saved as raw bytes.
+     */
+    static_assert(std::is_trivially_copyable_v<value_type>, "The content type is required to be trivially copyable.");
+
+    /**
+     * @brief Verify that files of the content type can be told apart from
+     *        files of other types.
+     */
+    static_assert(mapped_array_type_tag<value_type>::value != 0, "The content type requires a specialization of mapped_array_type_tag.");
+
+  private: // Classes
+    /**
+     * @brief The header at the start of the file.
+     *
+     * The header fills a cache line, so the values behind it are aligned.
+     */
+    struct header {
+        /**
+         * @brief Identifies the file format.
+         */
+        char magic[8];
+
+        /**
+         * @brief The size of a single value.
+         */
+        std::uint64_t content_size;
+
+        /**
+         * @brief The tag of the content type.
+         */
+        std::uint64_t type_tag;
+
+        /**
+         * @brief The amount of values.
+         */
+        std::uint64_t size;
+
+        /**
+         * @brief Reserved for later use.
+         */
+        std::uint64_t reserved[4];
+    };
+
+    /**
+     * @brief Verify that the header keeps the values aligned.
+     */
+    static_assert(sizeof(header) == 64 && alignof(content_type) <= sizeof(header), "The values behind the header have to be aligned.");
+
+  private: // Static members
+    /**
+     * @brief The identifier of the file format.
+     */
+    static const constexpr char s_magic[8]{'F', 'W', 'T', 'A', 'R', 'R', 'A', 'Y'};
+
+    /**
+     * @brief Whether the file is opened read-only.
+     */
+    static const constexpr bool s_read_only{std::is_const_v<content_type>};
+
+  private: // Member variables
+    /**
+     * @brief The file descriptor of the mapped file.
+     */
+    int m_file;
+
+    /**
+     * @brief The mapping of the whole file.
+     */
+    header *m_header;
+
+    /**
+     * @brief The size of the mapping in bytes.
+     */
+    std::size_t m_byte_size;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Maps a file.
+     *
+     * Throws a std::system_error if the file can not be opened or mapped, if
+     * its header does not match the content type or if a read-only array
+     * should create its file.
+     *
+     * @param _path The path of the file.
+     * @param _mode Whether the file is created or opened.
+     * @param _size The size of a created array, which is zero initialized.
+     *              Ignored when opening an existing file.
+     */
+    mapped_array(const std::string &_path, const mapped_array_mode &_mode, const std::size_t &_size = 0);
+
+    /**
+     * @brief Arrays own their mapping and can not be copied.
+     */
+    mapped_array(const mapped_array<content_type> &_other) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    mapped_array(mapped_array<content_type> &&_other);
+
+    /**
+     * @brief Unmaps and closes the file.
+     */
+    ~mapped_array();
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     *
+     * @return The array size.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns a pointer to the values.
+     */
+    content_type *data();
+
+    /**
+     * @brief Returns a constant pointer to the values.
+     */
+    const content_type *data() const;
+
+  public: // Functionality
+    /**
+     * @brief Resizes the array and its file to the new array size.
+     *
+     * The file is truncated or extended and the mapping is remapped, possibly
+     * to a new address. New values are zero initialized.
+     *
+     * @param _size The size of the array.
+     */
+    void resize(const std::size_t &_size)
+        requires(!s_read_only);
+
+    /**
+     * @brief Writes all changes to the file and waits for completion.
+     */
+    void flush()
+        requires(!s_read_only);
+
+  private: // Static functionality
+    /**
+     * @brief Throws a std::system_error for the current errno.
+     *
+     * @param _what The failed operation.
+     */
+    [[noreturn]] static void throw_system_error(const char *_what);
+
+    /**
+     * @brief Returns the size of a file for a given amount of values.
+     */
+    static std::size_t byte_size_for(const std::size_t &_size);
+
+  private: // Functionality
+    /**
+     * @brief Opens and maps the file and initializes or verifies the header.
+     */
+    void map(const std::string &_path, const mapped_array_mode &_mode, const std::size_t &_size);
+
+    /**
+     * @brief Unmaps and closes the file if it is open.
+     */
+    void unmap();
+
+  public: // Operators
+    /**
+     * @brief Get a reference to the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return Reference to the value at the given index.
+     */
+    content_type &operator[](const std::size_t &_index);
+
+    /**
+     * @brief Get a constant reference to the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return Constant reference to the value at the given index.
+     */
+    const content_type &operator[](const std::size_t &_index) const;
+
+    /**
+     * @brief Arrays own their mapping and can not be copied.
+     */
+    mapped_array &operator=(const mapped_array<content_type> &_other) = delete;
+
+    /**
+     * @brief Move operator.
+     */
+    mapped_array &operator=(mapped_array<content_type> &&_other);
+};
+
+#include "mapped_array.tpp"
+
+#endif // MAPPED_ARRAY_HPP_
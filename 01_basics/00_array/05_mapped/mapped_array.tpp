@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template <typename _content_type>
+mapped_array<_content_type>::mapped_array(const std::string &_path, const mapped_array_mode &_mode, const std::size_t &_size)
+    : m_file{-1},
+      m_header{nullptr},
+      m_byte_size{0}
+{
+    map(_path, _mode, _size);
+}
+
+template <typename _content_type>
+mapped_array<_content_type>::mapped_array(mapped_array<_content_type> &&_other)
+    : m_file{std::exchange(_other.m_file, -1)},
+      m_header{std::exchange(_other.m_header, nullptr)},
+      m_byte_size{std::exchange(_other.m_byte_size, 0)}
+{
+}
+
+template <typename _content_type>
+mapped_array<_content_type>::~mapped_array()
+{
+    unmap();
+}
+
+template <typename _content_type>
+std::size_t mapped_array<_content_type>::size() const
+{
+    return m_header ? static_cast<std::size_t>(m_header->size) : 0;
+}
+
+template <typename _content_type>
+_content_type *mapped_array<_content_type>::data()
+{
+    return reinterpret_cast<content_type *>(m_header + 1);
+}
+
+template <typename _content_type>
+const _content_type *mapped_array<_content_type>::data() const
+{
+    return reinterpret_cast<const content_type *>(m_header + 1);
+}
+
+template <typename _content_type>
+void mapped_array<_content_type>::resize(const std::size_t &_size)
+    requires(!s_read_only)
+{
+    const std::size_t byte_size{byte_size_for(_size)};
+
+    // The file has to be extended before the mapping can grow.
+    if (byte_size > m_byte_size && ftruncate(m_file, static_cast<off_t>(byte_size)) != 0) {
+        throw_system_error("ftruncate");
+    }
+
+    void *const mapping{mremap(m_header, m_byte_size, byte_size, MREMAP_MAYMOVE)};
+    if (mapping == MAP_FAILED) {
+        const int error{errno};
+        if (byte_size > m_byte_size) {
+            [[maybe_unused]] const int result{ftruncate(m_file, static_cast<off_t>(m_byte_size))};
+        }
+        errno = error;
+        throw_system_error("mremap");
+    }
+
+    const std::size_t old_byte_size{m_byte_size};
+
+    m_header       = static_cast<header *>(mapping);
+    m_byte_size    = byte_size;
+    m_header->size = _size;
+
+    if (byte_size < old_byte_size && ftruncate(m_file, static_cast<off_t>(byte_size)) != 0) {
+        throw_system_error("ftruncate");
+    }
+}
+
+template <typename _content_type>
+void mapped_array<_content_type>::flush()
+    requires(!s_read_only)
+{
+    if (msync(m_header, m_byte_size, MS_SYNC) != 0) {
+        throw_system_error("msync");
+    }
+}
+
+template <typename _content_type>
+void mapped_array<_content_type>::throw_system_error(const char *_what)
+{
+    throw std::system_error{errno, std::generic_category(), _what};
+}
+
+template <typename _content_type>
+std::size_t mapped_array<_content_type>::byte_size_for(const std::size_t &_size)
+{
+    return sizeof(header) + _size * sizeof(content_type);
+}
+
+template <typename _content_type>
+void mapped_array<_content_type>::map(const std::string &_path, const mapped_array_mode &_mode, const std::size_t &_size)
+{
+    if (s_read_only && _mode == mapped_array_mode::create) {
+        throw std::system_error{std::make_error_code(std::errc::invalid_argument), "mapped_array mode"};
+    }
+
+    try {
+        const int access{s_read_only ? O_RDONLY : O_RDWR};
+        const int flags{_mode == mapped_array_mode::create ? access | O_CREAT | O_TRUNC | O_CLOEXEC : access | O_CLOEXEC};
+
+        m_file = ::open(_path.c_str(), flags, 0644);
+        if (m_file < 0) {
+            throw_system_error("open");
+        }
+
+        if (_mode == mapped_array_mode::create) {
+            m_byte_size = byte_size_for(_size);
+
+            if (ftruncate(m_file, static_cast<off_t>(m_byte_size)) != 0) {
+                throw_system_error("ftruncate");
+            }
+        } else {
+            struct stat status;
+            if (fstat(m_file, &status) != 0) {
+                throw_system_error("fstat");
+            }
+
+            m_byte_size = static_cast<std::size_t>(status.st_size);
+            if (m_byte_size < sizeof(header)) {
+                throw std::system_error{std::make_error_code(std::errc::invalid_argument), "mapped_array header"};
+            }
+        }
+
+        const int   protection{s_read_only ? PROT_READ : PROT_READ | PROT_WRITE};
+        void *const mapping{mmap(nullptr, m_byte_size, protection, MAP_SHARED, m_file, 0)};
+        if (mapping == MAP_FAILED) {
+            throw_system_error("mmap");
+        }
+
+        m_header = static_cast<header *>(mapping);
+
+        if (_mode == mapped_array_mode::create) {
+            std::memcpy(m_header->magic, s_magic, sizeof(s_magic));
+            m_header->content_size = sizeof(content_type);
+            m_header->type_tag     = mapped_array_type_tag<value_type>::value;
+            m_header->size         = _size;
+        } else if (std::memcmp(m_header->magic, s_magic, sizeof(s_magic)) != 0
+                   || m_header->content_size != sizeof(content_type)
+                   || m_header->type_tag != mapped_array_type_tag<value_type>::value
+                   || m_header->size > (m_byte_size - sizeof(header)) / sizeof(content_type)) {
+            throw std::system_error{std::make_error_code(std::errc::invalid_argument), "mapped_array header"};
+        }
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+template <typename _content_type>
+void mapped_array<_content_type>::unmap()
+{
+    if (m_header) {
+        munmap(m_header, m_byte_size);
+    }
+
+    if (m_file >= 0) {
+        close(m_file);
+    }
+
+    m_file      = -1;
+    m_header    = nullptr;
+    m_byte_size = 0;
+}
+
+template <typename _content_type>
+_content_type &mapped_array<_content_type>::operator[](const std::size_t &_index)
+{
+    return data()[_index];
+}
+
+template <typename _content_type>
+const _content_type &mapped_array<_content_type>::operator[](const std::size_t &_index) const
+{
+    return data()[_index];
+}
+
+template <typename _content_type>
+mapped_array<_content_type> &mapped_array<_content_type>::operator=(mapped_array<_content_type> &&_other)
+{
+    if (this != &_other) {
+        unmap();
+
+        m_file      = std::exchange(_other.m_file, -1);
+        m_header    = std::exchange(_other.m_header, nullptr);
+        m_byte_size = std::exchange(_other.m_byte_size, 0);
+    }
+
+    return *this;
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+
+#include "parallel.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of runs per measurement, the fastest run is reported.
+ */
+static const constexpr std::size_t s_repetitions{5};
+
+/**
+ * @brief The measured times of all algorithms in ms.
+ */
+struct benchmark_result {
+    double fill;
+    double transform;
+    double reduce;
+    double count;
+};
+
+/**
+ * @brief Returns the time of the fastest run of a function in ms.
+ */
+template <typename _function_type>
+double measure(const _function_type &_function)
+{
+    double ret{0};
+    for (std::size_t i{0}; i < s_repetitions; ++i) {
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+        _function();
+        const double elapsed{std::chrono::duration<double, std::milli>{benchmark_clock::now() - start}.count()};
+
+        ret = i == 0 ? elapsed : std::min(ret, elapsed);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Measures all algorithms with a given amount of threads.
+ *
+ * @param _thread_count The amount of threads.
+ * @param _size The amount of values.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @return The measured times.
+ */
+benchmark_result benchmark_threads(const std::size_t &_thread_count, const std::size_t &_size, double &_sum)
+{
+    thread_pool pool{_thread_count};
+
+    array<double> source{0};
+    array<double> destination{0};
+    array<bool>   bits{_size};
+
+    // The arrays are first touched by the pool.
+    source.resize_uninitialized(_size);
+    destination.resize_uninitialized(_size);
+
+    benchmark_result ret{};
+    ret.fill      = measure([&]() { parallel_fill(pool, source, 1.5); });
+    ret.transform = measure([&]() { parallel_transform(pool, source, destination, [](const double &_value) { return std::sqrt(_value) * 2.0 + 1.0; }); });
+    ret.reduce    = measure([&]() { _sum += parallel_reduce(pool, destination, 0.0, std::plus<>{}); });
+
+    parallel_fill(pool, bits, true);
+    ret.count = measure([&]() { _sum += static_cast<double>(parallel_count(pool, bits)); });
+
+    return ret;
+}
+
+/**
+ * @brief The main function.
+ *
+ * Measures the speedup from one thread to all hardware threads. The first
+ * optional argument is the amount of values.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t size{std::size_t{1} << 24};
+    if (_argc > 1) {
+        size = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    const std::size_t max_thread_count{std::max<std::size_t>(std::thread::hardware_concurrency(), 1)};
+
+    std::cout << size << " values, " << max_thread_count << " hardware threads\n";
+    std::cout << "threads | fill: ms, speedup | transform: ms, speedup | reduce: ms, speedup | bool count: ms, speedup\n";
+
+    double           sum{0};
+    benchmark_result single{};
+    for (std::size_t thread_count{1}; thread_count <= max_thread_count; thread_count = thread_count < max_thread_count && thread_count * 2 > max_thread_count ? max_thread_count : thread_count * 2) {
+        const benchmark_result result{benchmark_threads(thread_count, size, sum)};
+        if (thread_count == 1) {
+            single = result;
+        }
+
+        std::cout << thread_count
+                  << " | " << result.fill << ", " << (single.fill / result.fill)
+                  << " | " << result.transform << ", " << (single.transform / result.transform)
+                  << " | " << result.reduce << ", " << (single.reduce / result.reduce)
+                  << " | " << result.count << ", " << (single.count / result.count) << '\n';
+
+        if (thread_count == max_thread_count) {
+            break;
+        }
+    }
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
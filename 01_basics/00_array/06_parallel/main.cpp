@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+#include "parallel.hpp"
+
+template <typename _array_type, typename _allocator_type, std::size_t _inline_capacity>
+void print_array(const array<_array_type, _allocator_type, _inline_capacity> &_arr)
+{
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        std::cout << ' ' << _arr[i];
+    }
+
+    std::cout << " ]\n";
+}
+
+int main()
+{
+    thread_pool pool{4};
+
+    // The pages of the uninitialized array are first touched by the threads.
+    array<double> double_arr{0};
+    double_arr.resize_uninitialized(1000);
+    parallel_fill(pool, double_arr, 0.5);
+
+    array<int> int_arr{11};
+    parallel_for_each_index(pool, int_arr, [&int_arr](const std::size_t &_index) { int_arr[_index] = static_cast<int>(_index) - 5; });
+    print_array(int_arr);
+
+    array<double> square_arr{int_arr.size()};
+    parallel_transform(pool, int_arr, square_arr, [](const int &_value) { return _value * 0.5 * _value; });
+    print_array(square_arr);
+
+    std::cout << "Sum: " << parallel_reduce(pool, double_arr, 0.0, std::plus<>{}) << ", maximum: "
+              << parallel_reduce(pool, int_arr, 0, [](const int &_left, const int &_right) { return std::max(_left, _right); }) << '\n';
+
+    // Bool arrays are processed a whole word at a time.
+    array<bool> bool_arr{1000};
+    array<bool> mask_arr{1000};
+    array<bool> result_arr{1000};
+    parallel_fill(pool, bool_arr, true);
+    for (std::size_t i{0}; i < mask_arr.size(); i += 3) {
+        mask_arr[i] = true;
+    }
+
+    parallel_transform(pool, bool_arr, mask_arr, result_arr, std::bit_xor<>{});
+    std::cout << "True values: " << parallel_count(pool, bool_arr) << " xor " << parallel_count(pool, mask_arr) << " = " << parallel_count(pool, result_arr);
+
+    parallel_transform(pool, result_arr, result_arr, std::bit_not<>{});
+    std::cout << ", inverted " << parallel_count(pool, result_arr) << '\n';
+
+    return 0;
+}
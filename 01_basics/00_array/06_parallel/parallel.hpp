@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef PARALLEL_HPP_
+#define PARALLEL_HPP_
+
+#include <cstddef>
+
+#include "array.hpp"
+#include "thread_pool.hpp"
+
+/**
+ * @brief Assigns a value to all values of an array in parallel.
+ *
+ * Filling an array created with resize_uninitialized() first touches its
+ * pages on the threads processing them later, so on NUMA systems the memory
+ * is placed near them.
+ *
+ * @param _pool The threads used.
+ * @param _array The filled array.
+ * @param _value The assigned value.
+ */
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+void parallel_fill(thread_pool &_pool, array<_content_type, _allocator_type, _inline_capacity> &_array, const _content_type &_value);
+
+/**
+ * @brief Assigns the result of an operation on every value of a source array
+ *        to the value with the same index of a destination array in parallel.
+ *
+ * @param _pool The threads used.
+ * @param _source The source array, which is not smaller than the destination.
+ * @param _destination The destination array.
+ * @param _operation The operation, which is called concurrently.
+ */
+template <typename _source_type, typename _source_allocator_type, std::size_t _source_inline_capacity,
+          typename _content_type, typename _allocator_type, std::size_t _inline_capacity,
+          typename _operation_type>
+void parallel_transform(thread_pool                                                               &_pool,
+                        const array<_source_type, _source_allocator_type, _source_inline_capacity> &_source,
+                        array<_content_type, _allocator_type, _inline_capacity>                    &_destination,
+                        const _operation_type                                                      &_operation);
+
+/**
+ * @brief Reduces all values of an array in parallel.
+ *
+ * Every thread reduces its chunk, then the partial results are reduced in
+ * order. Like std::reduce, the operation has to be associative and
+ * commutative and accept values and partial results in any combination.
+ *
+ * @param _pool The threads used.
+ * @param _array The reduced array.
+ * @param _initial The initial value of the reduction.
+ * @param _operation The operation, which is called concurrently.
+ * @return The reduced value.
+ */
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity, typename _result_type, typename _operation_type>
+_result_type parallel_reduce(thread_pool                                                   &_pool,
+                             const array<_content_type, _allocator_type, _inline_capacity> &_array,
+                             const _result_type                                            &_initial,
+                             const _operation_type                                         &_operation);
+
+/**
+ * @brief Calls a function with every index of an array in parallel.
+ *
+ * @param _pool The threads used.
+ * @param _array The array whose indices are visited.
+ * @param _function The function, which is called concurrently.
+ */
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity, typename _function_type>
+void parallel_for_each_index(thread_pool &_pool, array<_content_type, _allocator_type, _inline_capacity> &_array, const _function_type &_function);
+
+/**
+ * @brief Assigns a value to all values of a bool array in parallel, a whole
+ *        word at a time.
+ *
+ * @param _pool The threads used.
+ * @param _array The filled array.
+ * @param _value The assigned value.
+ */
+template <typename _allocator_type, std::size_t _inline_capacity>
+void parallel_fill(thread_pool &_pool, array<bool, _allocator_type, _inline_capacity> &_array, const bool &_value);
+
+/**
+ * @brief Assigns the result of an operation on every word of a source array
+ *        to the word with the same index of a destination array in parallel.
+ *
+ * Bits behind the last value are cleared afterwards.
+ *
+ * @param _pool The threads used.
+ * @param _source The source array, which is not smaller than the destination.
+ * @param _destination The destination array.
+ * @param _operation The operation on words, e.g. std::bit_not<>{}.
+ */
+template <typename _allocator_type, std::size_t _inline_capacity, typename _operation_type>
+void parallel_transform(thread_pool                                          &_pool,
+                        const array<bool, _allocator_type, _inline_capacity> &_source,
+                        array<bool, _allocator_type, _inline_capacity>       &_destination,
+                        const _operation_type                                &_operation);
+
+/**
+ * @brief Assigns the result of an operation on the words of two source arrays
+ *        to the words of a destination array in parallel.
+ *
+ * Bits behind the last value are cleared afterwards.
+ *
+ * @param _pool The threads used.
+ * @param _left The first source array, which is not smaller than the
+ *              destination.
+ * @param _right The second source array, which is not smaller than the
+ *               destination.
+ * @param _destination The destination array.
+ * @param _operation The operation on words, e.g. std::bit_and<>{}.
+ */
+template <typename _allocator_type, std::size_t _inline_capacity, typename _operation_type>
+void parallel_transform(thread_pool                                          &_pool,
+                        const array<bool, _allocator_type, _inline_capacity> &_left,
+                        const array<bool, _allocator_type, _inline_capacity> &_right,
+                        array<bool, _allocator_type, _inline_capacity>       &_destination,
+                        const _operation_type                                &_operation);
+
+/**
+ * @brief Counts the true values of a bool array in parallel, a whole word at
+ *        a time.
+ *
+ * @param _pool The threads used.
+ * @param _array The counted array.
+ * @return The amount of true values.
+ */
+template <typename _allocator_type, std::size_t _inline_capacity>
+std::size_t parallel_count(thread_pool &_pool, const array<bool, _allocator_type, _inline_capacity> &_array);
+
+#include "parallel.tpp"
+
+#endif // PARALLEL_HPP_
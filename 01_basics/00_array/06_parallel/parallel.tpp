@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <vector>
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity>
+void parallel_fill(thread_pool &_pool, array<_content_type, _allocator_type, _inline_capacity> &_array, const _content_type &_value)
+{
+    _content_type *const data{_array.data()};
+    const std::size_t    size{_array.size()};
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(data, sizeof(_content_type), size, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            data[i] = _value;
+        }
+    });
+}
+
+template <typename _source_type, typename _source_allocator_type, std::size_t _source_inline_capacity,
+          typename _content_type, typename _allocator_type, std::size_t _inline_capacity,
+          typename _operation_type>
+void parallel_transform(thread_pool                                                               &_pool,
+                        const array<_source_type, _source_allocator_type, _source_inline_capacity> &_source,
+                        array<_content_type, _allocator_type, _inline_capacity>                    &_destination,
+                        const _operation_type                                                      &_operation)
+{
+    assert(_source.size() >= _destination.size());
+
+    const _source_type *const source{_source.data()};
+    _content_type *const      destination{_destination.data()};
+    const std::size_t         size{_destination.size()};
+
+    // The chunks follow the written array.
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(destination, sizeof(_content_type), size, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            destination[i] = _operation(source[i]);
+        }
+    });
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity, typename _result_type, typename _operation_type>
+_result_type parallel_reduce(thread_pool                                                   &_pool,
+                             const array<_content_type, _allocator_type, _inline_capacity> &_array,
+                             const _result_type                                            &_initial,
+                             const _operation_type                                         &_operation)
+{
+    const _content_type *const data{_array.data()};
+    const std::size_t          size{_array.size()};
+
+    // Every partial result fills its own cache line.
+    struct alignas(thread_pool::cache_line_size) partial_result {
+        _result_type value;
+        bool         valid;
+    };
+
+    std::vector<partial_result> partial_results(_pool.thread_count());
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(data, sizeof(_content_type), size, _index)};
+
+        if (first == last) {
+            partial_results[_index].valid = false;
+            return;
+        }
+
+        _result_type result{static_cast<_result_type>(data[first])};
+        for (std::size_t i{first + 1}; i < last; ++i) {
+            result = _operation(result, data[i]);
+        }
+
+        partial_results[_index] = partial_result{result, true};
+    });
+
+    _result_type ret{_initial};
+    for (const partial_result &partial : partial_results) {
+        if (partial.valid) {
+            ret = _operation(ret, partial.value);
+        }
+    }
+
+    return ret;
+}
+
+template <typename _content_type, typename _allocator_type, std::size_t _inline_capacity, typename _function_type>
+void parallel_for_each_index(thread_pool &_pool, array<_content_type, _allocator_type, _inline_capacity> &_array, const _function_type &_function)
+{
+    const _content_type *const data{_array.data()};
+    const std::size_t          size{_array.size()};
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(data, sizeof(_content_type), size, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            _function(i);
+        }
+    });
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+void parallel_fill(thread_pool &_pool, array<bool, _allocator_type, _inline_capacity> &_array, const bool &_value)
+{
+    typedef typename array<bool, _allocator_type, _inline_capacity>::word_type word_type;
+
+    word_type *const  words{_array.words()};
+    const std::size_t word_count{_array.word_count()};
+    const std::size_t size{_array.size()};
+    const word_type   word{_value ? ~word_type{0} : word_type{0}};
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(words, sizeof(word_type), word_count, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            words[i] = word;
+        }
+    });
+
+    // Bits behind the last value have to stay zero.
+    const std::size_t used_bits{size % (CHAR_BIT * sizeof(word_type))};
+    if (word_count > 0 && used_bits > 0) {
+        words[word_count - 1] &= (word_type{1} << used_bits) - 1;
+    }
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity, typename _operation_type>
+void parallel_transform(thread_pool                                          &_pool,
+                        const array<bool, _allocator_type, _inline_capacity> &_source,
+                        array<bool, _allocator_type, _inline_capacity>       &_destination,
+                        const _operation_type                                &_operation)
+{
+    typedef typename array<bool, _allocator_type, _inline_capacity>::word_type word_type;
+
+    assert(_source.size() >= _destination.size());
+
+    const word_type *const source{_source.words()};
+    word_type *const       destination{_destination.words()};
+    const std::size_t      word_count{_destination.word_count()};
+    const std::size_t      size{_destination.size()};
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(destination, sizeof(word_type), word_count, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            destination[i] = static_cast<word_type>(_operation(source[i]));
+        }
+    });
+
+    const std::size_t used_bits{size % (CHAR_BIT * sizeof(word_type))};
+    if (word_count > 0 && used_bits > 0) {
+        destination[word_count - 1] &= (word_type{1} << used_bits) - 1;
+    }
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity, typename _operation_type>
+void parallel_transform(thread_pool                                          &_pool,
+                        const array<bool, _allocator_type, _inline_capacity> &_left,
+                        const array<bool, _allocator_type, _inline_capacity> &_right,
+                        array<bool, _allocator_type, _inline_capacity>       &_destination,
+                        const _operation_type                                &_operation)
+{
+    typedef typename array<bool, _allocator_type, _inline_capacity>::word_type word_type;
+
+    assert(_left.size() >= _destination.size() && _right.size() >= _destination.size());
+
+    const word_type *const left{_left.words()};
+    const word_type *const right{_right.words()};
+    word_type *const       destination{_destination.words()};
+    const std::size_t      word_count{_destination.word_count()};
+    const std::size_t      size{_destination.size()};
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(destination, sizeof(word_type), word_count, _index)};
+
+        for (std::size_t i{first}; i < last; ++i) {
+            destination[i] = static_cast<word_type>(_operation(left[i], right[i]));
+        }
+    });
+
+    const std::size_t used_bits{size % (CHAR_BIT * sizeof(word_type))};
+    if (word_count > 0 && used_bits > 0) {
+        destination[word_count - 1] &= (word_type{1} << used_bits) - 1;
+    }
+}
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+std::size_t parallel_count(thread_pool &_pool, const array<bool, _allocator_type, _inline_capacity> &_array)
+{
+    typedef typename array<bool, _allocator_type, _inline_capacity>::word_type word_type;
+
+    const word_type *const words{_array.words()};
+    const std::size_t      word_count{_array.word_count()};
+
+    struct alignas(thread_pool::cache_line_size) partial_count {
+        std::size_t value;
+    };
+
+    std::vector<partial_count> partial_counts(_pool.thread_count());
+
+    _pool.run([&](const std::size_t &_index) {
+        const auto [first, last]{_pool.chunk(words, sizeof(word_type), word_count, _index)};
+
+        std::size_t count{0};
+        for (std::size_t i{first}; i < last; ++i) {
+            count += static_cast<std::size_t>(std::popcount(words[i]));
+        }
+
+        partial_counts[_index].value = count;
+    });
+
+    std::size_t ret{0};
+    for (const partial_count &partial : partial_counts) {
+        ret += partial.value;
+    }
+
+    return ret;
+}
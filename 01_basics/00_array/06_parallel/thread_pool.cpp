@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+thread_pool::thread_pool(const std::size_t &_thread_count)
+    : m_job{nullptr},
+      m_generation{0},
+      m_running{0},
+      m_stop{false}
+{
+    for (std::size_t i{1}; i < _thread_count; ++i) {
+        m_threads.emplace_back(&thread_pool::work, this, i);
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        m_stop = true;
+    }
+
+    m_job_available.notify_all();
+
+    for (std::thread &thread : m_threads) {
+        thread.join();
+    }
+}
+
+std::size_t thread_pool::thread_count() const
+{
+    return m_threads.size() + 1;
+}
+
+void thread_pool::run(const std::function<void(const std::size_t &)> &_job)
+{
+    const std::lock_guard<std::mutex> run_lock{m_run_mutex};
+
+    {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        m_job       = &_job;
+        m_running   = m_threads.size();
+        m_exception = nullptr;
+        ++m_generation;
+    }
+
+    m_job_available.notify_all();
+
+    try {
+        _job(0);
+    } catch (...) {
+        const std::lock_guard<std::mutex> lock{m_mutex};
+        if (!m_exception) {
+            m_exception = std::current_exception();
+        }
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_job_finished.wait(lock, [this]() { return m_running == 0; });
+    m_job = nullptr;
+
+    if (m_exception) {
+        std::rethrow_exception(std::exchange(m_exception, nullptr));
+    }
+}
+
+std::pair<std::size_t, std::size_t> thread_pool::chunk(const void *_data, const std::size_t &_value_size, const std::size_t &_size, const std::size_t &_index) const
+{
+    return {chunk_boundary(_data, _value_size, _size, _index), chunk_boundary(_data, _value_size, _size, _index + 1)};
+}
+
+std::size_t thread_pool::default_thread_count()
+{
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void thread_pool::work(const std::size_t &_index)
+{
+    std::size_t generation{0};
+
+    while (true) {
+        const std::function<void(const std::size_t &)> *job{nullptr};
+
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_job_available.wait(lock, [this, &generation]() { return m_stop || m_generation != generation; });
+
+            if (m_stop) {
+                return;
+            }
+
+            generation = m_generation;
+            job        = m_job;
+        }
+
+        try {
+            (*job)(_index);
+        } catch (...) {
+            const std::lock_guard<std::mutex> lock{m_mutex};
+            if (!m_exception) {
+                m_exception = std::current_exception();
+            }
+        }
+
+        bool finished{false};
+        {
+            const std::lock_guard<std::mutex> lock{m_mutex};
+            finished = --m_running == 0;
+        }
+
+        if (finished) {
+            m_job_finished.notify_one();
+        }
+    }
+}
+
+std::size_t thread_pool::chunk_boundary(const void *_data, const std::size_t &_value_size, const std::size_t &_size, const std::size_t &_index) const
+{
+    if (_index == 0) {
+        return 0;
+    }
+
+    if (_index >= thread_count()) {
+        return _size;
+    }
+
+    const std::size_t    boundary{_size / thread_count() * _index + _size % thread_count() * _index / thread_count()};
+    const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(_data)};
+
+    if (_value_size == 0 || _value_size > cache_line_size || cache_line_size % _value_size != 0 || address % _value_size != 0) {
+        return boundary;
+    }
+
+    // The index of the first value starting a cache line.
+    const std::size_t values_per_line{cache_line_size / _value_size};
+    const std::size_t first_line{(cache_line_size - address % cache_line_size) % cache_line_size / _value_size};
+
+    if (boundary <= first_line) {
+        return std::min(first_line, _size);
+    }
+
+    return std::min(first_line + (boundary - first_line + values_per_line - 1) / values_per_line * values_per_line, _size);
+}
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A reusable pool of threads running fork-join jobs.
+ *
+ * Every job is run once per thread with the index of the thread, where index
+ * zero is the thread calling run(). A range is split into one chunk per
+ * thread, so the same chunk of the same range is always processed by the
+ * same thread. Memory first touched by a parallel algorithm therefore lands
+ * near the thread using it later.
+ */
+class thread_pool {
+  private: // Member variables
+    /**
+     * @brief The worker threads, the calling thread is not included.
+     */
+    std::vector<std::thread> m_threads;
+
+    /**
+     * @brief Allows only one job at a time.
+     */
+    std::mutex m_run_mutex;
+
+    /**
+     * @brief Protects the job state.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Signals the workers that a job is available or that they have
+     *        to stop.
+     */
+    std::condition_variable m_job_available;
+
+    /**
+     * @brief Signals the calling thread that all workers finished the job.
+     */
+    std::condition_variable m_job_finished;
+
+    /**
+     * @brief The current job.
+     */
+    const std::function<void(const std::size_t &)> *m_job;
+
+    /**
+     * @brief The amount of started jobs, so every worker runs a job once.
+     */
+    std::size_t m_generation;
+
+    /**
+     * @brief The amount of workers still running the current job.
+     */
+    std::size_t m_running;
+
+    /**
+     * @brief The first exception thrown by the current job.
+     */
+    std::exception_ptr m_exception;
+
+    /**
+     * @brief Whether the workers have to stop.
+     */
+    bool m_stop;
+
+  public: // Static members
+    /**
+     * @brief The size of a cache line, which is never shared by two chunks.
+     */
+    static const constexpr std::size_t cache_line_size{64};
+
+  public: // Constructors and destructor
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param _thread_count The amount of threads running a job, including
+     *                      the calling thread.
+     */
+    explicit thread_pool(const std::size_t &_thread_count = default_thread_count());
+
+    /**
+     * @brief The threads refer to their pool, so it can not be copied.
+     */
+    thread_pool(const thread_pool &_other) = delete;
+
+    /**
+     * @brief Stops and joins the worker threads.
+     */
+    ~thread_pool();
+
+  public: // Getter
+    /**
+     * @brief Returns the amount of threads running a job, including the
+     *        calling thread.
+     */
+    std::size_t thread_count() const;
+
+  public: // Functionality
+    /**
+     * @brief Runs a job on all threads and waits until all finished.
+     *
+     * Rethrows the first exception thrown by the job. Jobs must not run
+     * further jobs on the same pool.
+     *
+     * @param _job The job, which is called with the index of the thread.
+     */
+    void run(const std::function<void(const std::size_t &)> &_job);
+
+    /**
+     * @brief Returns the chunk of a range of values processed by a thread.
+     *
+     * The chunks are about equally large. Their boundaries are moved to
+     * cache line boundaries if the values fit evenly into cache lines, so
+     * two threads never write to the same cache line.
+     *
+     * @param _data The first value of the range.
+     * @param _value_size The size of a single value.
+     * @param _size The amount of values.
+     * @param _index The index of the thread.
+     * @return The first index and the index behind the chunk.
+     */
+    std::pair<std::size_t, std::size_t> chunk(const void *_data, const std::size_t &_value_size, const std::size_t &_size, const std::size_t &_index) const;
+
+  private: // Static functionality
+    /**
+     * @brief Returns the amount of hardware threads, but at least one.
+     */
+    static std::size_t default_thread_count();
+
+  private: // Functionality
+    /**
+     * @brief The loop of a worker thread.
+     *
+     * @param _index The index of the worker thread.
+     */
+    void work(const std::size_t &_index);
+
+    /**
+     * @brief Returns the start of the chunk of a thread.
+     */
+    std::size_t chunk_boundary(const void *_data, const std::size_t &_value_size, const std::size_t &_size, const std::size_t &_index) const;
+
+  public: // Operators
+    /**
+     * @brief The threads refer to their pool, so it can not be assigned.
+     */
+    thread_pool &operator=(const thread_pool &_other) = delete;
+};
+
+#endif // THREAD_POOL_HPP_
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "compressed_bitmap.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Creates a bool array with a given density of true values.
+ *
+ * @param _size The size of the array.
+ * @param _density The probability of a value being true.
+ * @param _run_length The length of the ranges sharing a value.
+ * @param _state The state of the random number generator.
+ * @return The bool array.
+ */
+array<bool> create_array(const std::size_t &_size, const double &_density, const std::size_t &_run_length, std::uint64_t &_state)
+{
+    array<bool> ret{_size};
+
+    const std::uint64_t threshold{static_cast<std::uint64_t>(_density * 4294967296.0)};
+    for (std::size_t i{0}; i < _size; i += _run_length) {
+        _state = _state * 6364136223846793005u + 1442695040888963407u;
+
+        if ((_state >> 32) < threshold) {
+            for (std::size_t j{i}; j < i + _run_length && j < _size; ++j) {
+                ret[j] = true;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Returns the time a function takes in ms.
+ */
+template <typename _function_type>
+double measure(const _function_type &_function)
+{
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+    _function();
+
+    return std::chrono::duration<double, std::milli>{benchmark_clock::now() - start}.count();
+}
+
+/**
+ * @brief Compares a dense bool array with a compressed bitmap for a given
+ *        density.
+ *
+ * @param _size The size of the arrays.
+ * @param _density The probability of a value being true.
+ * @param _run_length The length of the ranges sharing a value.
+ * @param _state The state of the random number generator.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ */
+void benchmark_density(const std::size_t &_size, const double &_density, const std::size_t &_run_length, std::uint64_t &_state, std::uint64_t &_sum)
+{
+    const array<bool> left_arr{create_array(_size, _density, _run_length, _state)};
+    const array<bool> right_arr{create_array(_size, _density, _run_length, _state)};
+
+    const compressed_bitmap left{left_arr};
+    const compressed_bitmap right{right_arr};
+
+    const double dense_and{measure([&]() {
+        array<bool> result{left_arr};
+        result &= right_arr;
+        _sum += result.count();
+    })};
+    const double dense_or{measure([&]() {
+        array<bool> result{left_arr};
+        result |= right_arr;
+        _sum += result.count();
+    })};
+    const double compressed_and{measure([&]() { _sum += (left & right).count(); })};
+    const double compressed_or{measure([&]() { _sum += (left | right).count(); })};
+    const double compressed_count{measure([&]() { _sum += left.intersection_count(right); })};
+
+    std::cout << _density * 100 << "% x" << _run_length << " | " << left_arr.used_bits() / 8 << ", " << dense_and << ", " << dense_or
+              << " | " << left.memory_usage() << ", " << compressed_and << ", " << compressed_or << ", " << compressed_count << '\n';
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the size of the arrays.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t size{std::size_t{1} << 26};
+    if (_argc > 1) {
+        size = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::cout << "density | dense: bytes, and ms, or ms | compressed: bytes, and ms, or ms, intersection count ms\n";
+
+    std::uint64_t state{42};
+    std::uint64_t sum{0};
+    benchmark_density(size, 0.001, 1, state, sum);
+    benchmark_density(size, 0.01, 1, state, sum);
+    benchmark_density(size, 0.1, 1, state, sum);
+    benchmark_density(size, 0.5, 1, state, sum);
+    benchmark_density(size, 0.01, 1000, state, sum);
+    benchmark_density(size, 0.5, 1000, state, sum);
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
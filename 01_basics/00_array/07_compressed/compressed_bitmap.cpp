@@ -0,0 +1,659 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "compressed_bitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+compressed_bitmap::compressed_bitmap(const std::size_t &_size)
+    : m_size{_size},
+      m_containers{}
+{
+}
+
+std::size_t compressed_bitmap::size() const
+{
+    return m_size;
+}
+
+std::size_t compressed_bitmap::count() const
+{
+    std::size_t ret{0};
+    for (const container &current : m_containers) {
+        ret += current.cardinality;
+    }
+
+    return ret;
+}
+
+std::size_t compressed_bitmap::memory_usage() const
+{
+    std::size_t ret{m_containers.capacity() * sizeof(container)};
+    for (const container &current : m_containers) {
+        ret += current.values.capacity() * sizeof(std::uint16_t) + current.words.capacity() * sizeof(std::uint64_t);
+    }
+
+    return ret;
+}
+
+void compressed_bitmap::container_counts(std::size_t &_sorted, std::size_t &_dense, std::size_t &_runs) const
+{
+    _sorted = 0;
+    _dense  = 0;
+    _runs   = 0;
+
+    for (const container &current : m_containers) {
+        switch (current.kind) {
+        case container_kind::sorted:
+            ++_sorted;
+            break;
+        case container_kind::dense:
+            ++_dense;
+            break;
+        case container_kind::runs:
+            ++_runs;
+            break;
+        }
+    }
+}
+
+std::size_t compressed_bitmap::intersection_count(const compressed_bitmap &_other) const
+{
+    assert(m_size == _other.m_size && "Both bitmaps are required to have the same size.");
+
+    std::size_t ret{0};
+
+    auto left{m_containers.begin()};
+    auto right{_other.m_containers.begin()};
+    while (left != m_containers.end() && right != _other.m_containers.end()) {
+        if (left->key < right->key) {
+            ++left;
+        } else if (right->key < left->key) {
+            ++right;
+        } else {
+            ret += intersect_count(*left++, *right++);
+        }
+    }
+
+    return ret;
+}
+
+std::size_t compressed_bitmap::union_count(const compressed_bitmap &_other) const
+{
+    assert(m_size == _other.m_size && "Both bitmaps are required to have the same size.");
+
+    return count() + _other.count() - intersection_count(_other);
+}
+
+void compressed_bitmap::set(const std::size_t &_index, const bool &_value)
+{
+    if (_index >= m_size) {
+        throw std::system_error{std::make_error_code(std::errc::invalid_argument), "compressed_bitmap index"};
+    }
+
+    const std::size_t   key{_index / chunk_size};
+    const std::uint16_t value{static_cast<std::uint16_t>(_index % chunk_size)};
+    const std::size_t   position{find_container(m_containers, key)};
+
+    if (position == m_containers.size() || m_containers[position].key != key) {
+        if (_value) {
+            m_containers.insert(m_containers.begin() + static_cast<std::ptrdiff_t>(position), container{key, container_kind::sorted, 1, {value}, {}});
+        }
+
+        return;
+    }
+
+    container &current{m_containers[position]};
+
+    if (current.kind == container_kind::runs) {
+        // Run lists are expanded, as a single change might split a run.
+        if (current.cardinality <= s_max_sorted_size) {
+            current.values = to_values(current);
+            current.kind   = container_kind::sorted;
+        } else {
+            current.words = to_words(current);
+            current.values.clear();
+            current.kind = container_kind::dense;
+        }
+    }
+
+    if (current.kind == container_kind::sorted) {
+        const auto found{std::lower_bound(current.values.begin(), current.values.end(), value)};
+        const bool contained{found != current.values.end() && *found == value};
+
+        if (_value && !contained) {
+            if (current.cardinality < s_max_sorted_size) {
+                current.values.insert(found, value);
+                ++current.cardinality;
+            } else {
+                current.words = to_words(current);
+                current.values.clear();
+                current.kind = container_kind::dense;
+            }
+        } else if (!_value && contained) {
+            current.values.erase(found);
+            --current.cardinality;
+        }
+    }
+
+    if (current.kind == container_kind::dense) {
+        std::uint64_t      &word{current.words[value / 64]};
+        const std::uint64_t mask{std::uint64_t{1} << (value % 64)};
+
+        if (_value && !(word & mask)) {
+            word |= mask;
+            ++current.cardinality;
+        } else if (!_value && (word & mask)) {
+            word &= ~mask;
+            --current.cardinality;
+
+            if (current.cardinality <= s_max_sorted_size / 2) {
+                current.values = to_values(current);
+                current.words  = std::vector<std::uint64_t>{};
+                current.kind   = container_kind::sorted;
+            }
+        }
+    }
+
+    if (current.cardinality == 0) {
+        m_containers.erase(m_containers.begin() + static_cast<std::ptrdiff_t>(position));
+    }
+}
+
+void compressed_bitmap::optimize()
+{
+    for (container &current : m_containers) {
+        if (current.kind == container_kind::dense) {
+            current = from_words(current.key, std::move(current.words));
+        } else {
+            current = from_values(current.key, to_values(current));
+        }
+    }
+}
+
+std::size_t compressed_bitmap::find_container(const std::vector<container> &_containers, const std::size_t &_key)
+{
+    return static_cast<std::size_t>(std::lower_bound(_containers.begin(), _containers.end(), _key, [](const container &_container, const std::size_t &_current_key) { return _container.key < _current_key; }) - _containers.begin());
+}
+
+compressed_bitmap::container compressed_bitmap::from_words(const std::size_t &_key, std::vector<std::uint64_t> &&_words)
+{
+    std::size_t   cardinality{0};
+    std::size_t   runs{0};
+    std::uint64_t previous{0};
+
+    for (const std::uint64_t &word : _words) {
+        cardinality += static_cast<std::size_t>(std::popcount(word));
+
+        // A run starts at every true value following a false value.
+        runs += static_cast<std::size_t>(std::popcount(word & ~((word << 1) | (previous >> 63))));
+        previous = word;
+    }
+
+    container ret{_key, container_kind::dense, cardinality, {}, {}};
+
+    const std::size_t dense_bytes{s_chunk_word_size * sizeof(std::uint64_t)};
+    const std::size_t sorted_bytes{cardinality * sizeof(std::uint16_t)};
+    const std::size_t runs_bytes{runs * 2 * sizeof(std::uint16_t)};
+
+    if (runs_bytes < std::min(sorted_bytes, dense_bytes)) {
+        ret.kind = container_kind::runs;
+        ret.values.reserve(2 * runs);
+
+        for (std::size_t first{find_bit(_words, 0, true)}; first < chunk_size;) {
+            const std::size_t end{find_bit(_words, first, false)};
+
+            ret.values.push_back(static_cast<std::uint16_t>(first));
+            ret.values.push_back(static_cast<std::uint16_t>(end - 1));
+
+            first = end < chunk_size ? find_bit(_words, end, true) : chunk_size;
+        }
+    } else if (sorted_bytes < dense_bytes) {
+        ret.kind = container_kind::sorted;
+        ret.values.reserve(cardinality);
+
+        for (std::size_t i{0}; i < s_chunk_word_size; ++i) {
+            for (std::uint64_t word{_words[i]}; word != 0; word &= word - 1) {
+                ret.values.push_back(static_cast<std::uint16_t>(i * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+            }
+        }
+    } else {
+        ret.words = std::move(_words);
+    }
+
+    return ret;
+}
+
+compressed_bitmap::container compressed_bitmap::from_values(const std::size_t &_key, std::vector<std::uint16_t> &&_values)
+{
+    std::size_t runs{_values.empty() ? std::size_t{0} : std::size_t{1}};
+    for (std::size_t i{1}; i < _values.size(); ++i) {
+        if (_values[i] != _values[i - 1] + 1) {
+            ++runs;
+        }
+    }
+
+    container ret{_key, container_kind::sorted, _values.size(), {}, {}};
+
+    const std::size_t dense_bytes{s_chunk_word_size * sizeof(std::uint64_t)};
+    const std::size_t sorted_bytes{_values.size() * sizeof(std::uint16_t)};
+    const std::size_t runs_bytes{runs * 2 * sizeof(std::uint16_t)};
+
+    if (runs_bytes < std::min(sorted_bytes, dense_bytes)) {
+        ret.kind = container_kind::runs;
+        ret.values.reserve(2 * runs);
+
+        for (std::size_t i{0}; i < _values.size(); ++i) {
+            if (i == 0 || _values[i] != _values[i - 1] + 1) {
+                ret.values.push_back(_values[i]);
+                ret.values.push_back(_values[i]);
+            } else {
+                ret.values.back() = _values[i];
+            }
+        }
+    } else if (sorted_bytes < dense_bytes) {
+        ret.values = std::move(_values);
+    } else {
+        ret.kind = container_kind::dense;
+        ret.words.assign(s_chunk_word_size, 0);
+
+        for (const std::uint16_t &value : _values) {
+            ret.words[value / 64] |= std::uint64_t{1} << (value % 64);
+        }
+    }
+
+    return ret;
+}
+
+compressed_bitmap::container compressed_bitmap::from_runs(const std::size_t &_key, std::vector<std::uint16_t> &&_runs)
+{
+    std::size_t cardinality{0};
+    for (std::size_t i{0}; i < _runs.size(); i += 2) {
+        cardinality += std::size_t{_runs[i + 1]} - _runs[i] + 1;
+    }
+
+    container ret{_key, container_kind::runs, cardinality, std::move(_runs), {}};
+
+    const std::size_t dense_bytes{s_chunk_word_size * sizeof(std::uint64_t)};
+    const std::size_t sorted_bytes{cardinality * sizeof(std::uint16_t)};
+    const std::size_t runs_bytes{ret.values.size() * sizeof(std::uint16_t)};
+
+    if (runs_bytes < std::min(sorted_bytes, dense_bytes)) {
+        return ret;
+    }
+
+    if (sorted_bytes < dense_bytes) {
+        ret.values = to_values(ret);
+        ret.kind   = container_kind::sorted;
+    } else {
+        ret.words = to_words(ret);
+        ret.values.clear();
+        ret.kind = container_kind::dense;
+    }
+
+    return ret;
+}
+
+std::size_t compressed_bitmap::find_bit(const std::vector<std::uint64_t> &_words, const std::size_t &_first, const bool &_value)
+{
+    std::size_t   index{_first / 64};
+    std::uint64_t word{(_value ? _words[index] : ~_words[index]) & (~std::uint64_t{0} << (_first % 64))};
+
+    while (word == 0) {
+        if (++index == s_chunk_word_size) {
+            return chunk_size;
+        }
+
+        word = _value ? _words[index] : ~_words[index];
+    }
+
+    return index * 64 + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+void compressed_bitmap::fill_range(std::vector<std::uint64_t> &_words, const std::size_t &_first, const std::size_t &_last)
+{
+    const std::size_t first_word{_first / 64};
+    const std::size_t last_word{_last / 64};
+
+    const std::uint64_t first_mask{~std::uint64_t{0} << (_first % 64)};
+    const std::uint64_t last_mask{~std::uint64_t{0} >> (63 - _last % 64)};
+
+    if (first_word == last_word) {
+        _words[first_word] |= first_mask & last_mask;
+        return;
+    }
+
+    _words[first_word] |= first_mask;
+    std::fill(_words.begin() + static_cast<std::ptrdiff_t>(first_word + 1), _words.begin() + static_cast<std::ptrdiff_t>(last_word), ~std::uint64_t{0});
+    _words[last_word] |= last_mask;
+}
+
+std::vector<std::uint16_t> compressed_bitmap::to_values(const container &_container)
+{
+    if (_container.kind == container_kind::sorted) {
+        return _container.values;
+    }
+
+    std::vector<std::uint16_t> ret;
+    ret.reserve(_container.cardinality);
+
+    if (_container.kind == container_kind::runs) {
+        for (std::size_t i{0}; i < _container.values.size(); i += 2) {
+            for (std::size_t value{_container.values[i]}; value <= _container.values[i + 1]; ++value) {
+                ret.push_back(static_cast<std::uint16_t>(value));
+            }
+        }
+    } else {
+        for (std::size_t i{0}; i < s_chunk_word_size; ++i) {
+            for (std::uint64_t word{_container.words[i]}; word != 0; word &= word - 1) {
+                ret.push_back(static_cast<std::uint16_t>(i * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+            }
+        }
+    }
+
+    return ret;
+}
+
+std::vector<std::uint64_t> compressed_bitmap::to_words(const container &_container)
+{
+    if (_container.kind == container_kind::dense) {
+        return _container.words;
+    }
+
+    std::vector<std::uint64_t> ret(s_chunk_word_size, 0);
+
+    if (_container.kind == container_kind::runs) {
+        for (std::size_t i{0}; i < _container.values.size(); i += 2) {
+            fill_range(ret, _container.values[i], _container.values[i + 1]);
+        }
+    } else {
+        for (const std::uint16_t &value : _container.values) {
+            ret[value / 64] |= std::uint64_t{1} << (value % 64);
+        }
+    }
+
+    return ret;
+}
+
+bool compressed_bitmap::contains(const container &_container, const std::uint16_t &_value)
+{
+    switch (_container.kind) {
+    case container_kind::sorted:
+        return std::binary_search(_container.values.begin(), _container.values.end(), _value);
+    case container_kind::dense:
+        return (_container.words[_value / 64] >> (_value % 64)) & 1;
+    case container_kind::runs:
+        break;
+    }
+
+    // Find the last run starting at or before the value.
+    std::size_t first{0};
+    std::size_t last{_container.values.size() / 2};
+    while (first < last) {
+        const std::size_t middle{first + (last - first) / 2};
+
+        if (_container.values[2 * middle] <= _value) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+
+    return first > 0 && _value <= _container.values[2 * first - 1];
+}
+
+compressed_bitmap::container compressed_bitmap::intersect(const container &_left, const container &_right)
+{
+    if (_left.kind == container_kind::sorted && _right.kind == container_kind::sorted) {
+        std::vector<std::uint16_t> values;
+        std::set_intersection(_left.values.begin(), _left.values.end(), _right.values.begin(), _right.values.end(), std::back_inserter(values));
+
+        return from_values(_left.key, std::move(values));
+    }
+
+    if (_left.kind == container_kind::sorted || _right.kind == container_kind::sorted) {
+        // The sorted values are looked up in the other container.
+        const container &sorted{_left.kind == container_kind::sorted ? _left : _right};
+        const container &other{_left.kind == container_kind::sorted ? _right : _left};
+
+        std::vector<std::uint16_t> values;
+        for (const std::uint16_t &value : sorted.values) {
+            if (contains(other, value)) {
+                values.push_back(value);
+            }
+        }
+
+        return from_values(_left.key, std::move(values));
+    }
+
+    if (_left.kind == container_kind::runs && _right.kind == container_kind::runs) {
+        // Overlapping runs are intersected without expanding them.
+        std::vector<std::uint16_t> runs;
+        for (std::size_t left{0}, right{0}; left < _left.values.size() && right < _right.values.size();) {
+            const std::uint16_t first{std::max(_left.values[left], _right.values[right])};
+            const std::uint16_t last{std::min(_left.values[left + 1], _right.values[right + 1])};
+
+            if (first <= last) {
+                runs.push_back(first);
+                runs.push_back(last);
+            }
+
+            if (_left.values[left + 1] < _right.values[right + 1]) {
+                left += 2;
+            } else {
+                right += 2;
+            }
+        }
+
+        return from_runs(_left.key, std::move(runs));
+    }
+
+    std::vector<std::uint64_t>       words{to_words(_left)};
+    const std::vector<std::uint64_t> right_words{_right.kind == container_kind::dense ? std::vector<std::uint64_t>{} : to_words(_right)};
+    const std::vector<std::uint64_t> &other_words{_right.kind == container_kind::dense ? _right.words : right_words};
+
+    for (std::size_t i{0}; i < s_chunk_word_size; ++i) {
+        words[i] &= other_words[i];
+    }
+
+    return from_words(_left.key, std::move(words));
+}
+
+compressed_bitmap::container compressed_bitmap::unite(const container &_left, const container &_right)
+{
+    if (_left.kind == container_kind::sorted && _right.kind == container_kind::sorted) {
+        std::vector<std::uint16_t> values;
+        values.reserve(_left.values.size() + _right.values.size());
+        std::set_union(_left.values.begin(), _left.values.end(), _right.values.begin(), _right.values.end(), std::back_inserter(values));
+
+        return from_values(_left.key, std::move(values));
+    }
+
+    if (_left.kind == container_kind::runs && _right.kind == container_kind::runs) {
+        // Overlapping or touching runs are merged without expanding them.
+        std::vector<std::uint16_t> runs;
+        for (std::size_t left{0}, right{0}; left < _left.values.size() || right < _right.values.size();) {
+            const bool           take_left{right == _right.values.size() || (left < _left.values.size() && _left.values[left] < _right.values[right])};
+            const std::uint16_t *run{take_left ? &_left.values[left] : &_right.values[right]};
+            (take_left ? left : right) += 2;
+
+            if (!runs.empty() && std::size_t{run[0]} <= std::size_t{runs.back()} + 1) {
+                runs.back() = std::max(runs.back(), run[1]);
+            } else {
+                runs.push_back(run[0]);
+                runs.push_back(run[1]);
+            }
+        }
+
+        return from_runs(_left.key, std::move(runs));
+    }
+
+    std::vector<std::uint64_t> words{to_words(_left)};
+
+    if (_right.kind == container_kind::sorted) {
+        for (const std::uint16_t &value : _right.values) {
+            words[value / 64] |= std::uint64_t{1} << (value % 64);
+        }
+    } else if (_right.kind == container_kind::runs) {
+        for (std::size_t i{0}; i < _right.values.size(); i += 2) {
+            fill_range(words, _right.values[i], _right.values[i + 1]);
+        }
+    } else {
+        for (std::size_t i{0}; i < s_chunk_word_size; ++i) {
+            words[i] |= _right.words[i];
+        }
+    }
+
+    return from_words(_left.key, std::move(words));
+}
+
+std::size_t compressed_bitmap::intersect_count(const container &_left, const container &_right)
+{
+    std::size_t ret{0};
+
+    if (_left.kind == container_kind::sorted && _right.kind == container_kind::sorted) {
+        auto left{_left.values.begin()};
+        auto right{_right.values.begin()};
+        while (left != _left.values.end() && right != _right.values.end()) {
+            if (*left < *right) {
+                ++left;
+            } else if (*right < *left) {
+                ++right;
+            } else {
+                ++ret;
+                ++left;
+                ++right;
+            }
+        }
+
+        return ret;
+    }
+
+    if (_left.kind == container_kind::sorted || _right.kind == container_kind::sorted) {
+        const container &sorted{_left.kind == container_kind::sorted ? _left : _right};
+        const container &other{_left.kind == container_kind::sorted ? _right : _left};
+
+        for (const std::uint16_t &value : sorted.values) {
+            ret += contains(other, value) ? 1 : 0;
+        }
+
+        return ret;
+    }
+
+    if (_left.kind == container_kind::dense && _right.kind == container_kind::dense) {
+        for (std::size_t i{0}; i < s_chunk_word_size; ++i) {
+            ret += static_cast<std::size_t>(std::popcount(_left.words[i] & _right.words[i]));
+        }
+
+        return ret;
+    }
+
+    if (_left.kind == container_kind::runs && _right.kind == container_kind::runs) {
+        for (std::size_t left{0}, right{0}; left < _left.values.size() && right < _right.values.size();) {
+            const std::uint16_t first{std::max(_left.values[left], _right.values[right])};
+            const std::uint16_t last{std::min(_left.values[left + 1], _right.values[right + 1])};
+
+            if (first <= last) {
+                ret += std::size_t{last} - first + 1;
+            }
+
+            if (_left.values[left + 1] < _right.values[right + 1]) {
+                left += 2;
+            } else {
+                right += 2;
+            }
+        }
+
+        return ret;
+    }
+
+    return intersect(_left, _right).cardinality;
+}
+
+bool compressed_bitmap::operator[](const std::size_t &_index) const
+{
+    const std::size_t key{_index / chunk_size};
+    const std::size_t position{find_container(m_containers, key)};
+
+    return position < m_containers.size() && m_containers[position].key == key && contains(m_containers[position], static_cast<std::uint16_t>(_index % chunk_size));
+}
+
+compressed_bitmap &compressed_bitmap::operator&=(const compressed_bitmap &_other)
+{
+    return *this = *this & _other;
+}
+
+compressed_bitmap &compressed_bitmap::operator|=(const compressed_bitmap &_other)
+{
+    assert(m_size == _other.m_size && "Both bitmaps are required to have the same size.");
+
+    std::vector<container> containers;
+    containers.reserve(m_containers.size() + _other.m_containers.size());
+
+    auto left{m_containers.begin()};
+    auto right{_other.m_containers.begin()};
+    while (left != m_containers.end() || right != _other.m_containers.end()) {
+        if (right == _other.m_containers.end() || (left != m_containers.end() && left->key < right->key)) {
+            containers.push_back(std::move(*left++));
+        } else if (left == m_containers.end() || right->key < left->key) {
+            containers.push_back(*right++);
+        } else {
+            containers.push_back(unite(*left++, *right++));
+        }
+    }
+
+    m_containers = std::move(containers);
+
+    return *this;
+}
+
+compressed_bitmap compressed_bitmap::operator&(const compressed_bitmap &_other) const
+{
+    assert(m_size == _other.m_size && "Both bitmaps are required to have the same size.");
+
+    compressed_bitmap ret{m_size};
+
+    auto left{m_containers.begin()};
+    auto right{_other.m_containers.begin()};
+    while (left != m_containers.end() && right != _other.m_containers.end()) {
+        if (left->key < right->key) {
+            ++left;
+        } else if (right->key < left->key) {
+            ++right;
+        } else {
+            container current{intersect(*left++, *right++)};
+            if (current.cardinality > 0) {
+                ret.m_containers.push_back(std::move(current));
+            }
+        }
+    }
+
+    return ret;
+}
+
+compressed_bitmap compressed_bitmap::operator|(const compressed_bitmap &_other) const
+{
+    assert(m_size == _other.m_size && "Both bitmaps are required to have the same size.");
+
+    compressed_bitmap ret{m_size};
+    ret.m_containers.reserve(m_containers.size() + _other.m_containers.size());
+
+    auto left{m_containers.begin()};
+    auto right{_other.m_containers.begin()};
+    while (left != m_containers.end() || right != _other.m_containers.end()) {
+        if (right == _other.m_containers.end() || (left != m_containers.end() && left->key < right->key)) {
+            ret.m_containers.push_back(*left++);
+        } else if (left == m_containers.end() || right->key < left->key) {
+            ret.m_containers.push_back(*right++);
+        } else {
+            ret.m_containers.push_back(unite(*left++, *right++));
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,324 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef COMPRESSED_BITMAP_HPP_
+#define COMPRESSED_BITMAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "array.hpp"
+
+/**
+ * @brief A class implementing a compressed bitmap for sparse bool values.
+ *
+ * The index space is split into chunks of 2^16 values. Only chunks with at
+ * least one true value are saved, each in the smallest of three containers:
+ * a sorted array of the true values, a dense bitmap or a list of runs of
+ * true values. Set operations combine two bitmaps chunk by chunk and pick the
+ * cheapest algorithm for each pair of containers.
+ */
+class compressed_bitmap {
+  private: // Classes
+    /**
+     * @brief The kinds of containers used for a chunk.
+     */
+    enum class container_kind {
+        /**
+         * @brief Sorted array of the true values, 2 bytes per true value.
+         */
+        sorted,
+
+        /**
+         * @brief Dense bitmap, always 8 KiB.
+         */
+        dense,
+
+        /**
+         * @brief Sorted list of the first and last value of every run of true
+         *        values, 4 bytes per run.
+         */
+        runs
+    };
+
+    /**
+     * @brief The true values of a single chunk.
+     */
+    struct container {
+        /**
+         * @brief The index of the chunk.
+         */
+        std::size_t key;
+
+        /**
+         * @brief How the true values are saved.
+         */
+        container_kind kind;
+
+        /**
+         * @brief The amount of true values.
+         */
+        std::size_t cardinality;
+
+        /**
+         * @brief The sorted values or the runs, depending on the kind.
+         */
+        std::vector<std::uint16_t> values;
+
+        /**
+         * @brief The words of a dense bitmap.
+         */
+        std::vector<std::uint64_t> words;
+    };
+
+  public: // Static members
+    /**
+     * @brief The amount of values per chunk.
+     */
+    static const constexpr std::size_t chunk_size{std::size_t{1} << 16};
+
+  private: // Static members
+    /**
+     * @brief The amount of words of a dense bitmap.
+     */
+    static const constexpr std::size_t s_chunk_word_size{chunk_size / 64};
+
+    /**
+     * @brief The largest sorted array, which is as large as a dense bitmap.
+     */
+    static const constexpr std::size_t s_max_sorted_size{s_chunk_word_size * sizeof(std::uint64_t) / sizeof(std::uint16_t)};
+
+  private: // Member variables
+    /**
+     * @brief The amount of values.
+     */
+    std::size_t m_size;
+
+    /**
+     * @brief The containers of all chunks with true values, sorted by key.
+     */
+    std::vector<container> m_containers;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates a bitmap of a given size with all values being false.
+     *
+     * @param _size The size of the bitmap.
+     */
+    explicit compressed_bitmap(const std::size_t &_size);
+
+    /**
+     * @brief Compresses the values of a bool array.
+     *
+     * @param _array The compressed array.
+     */
+    template <typename _allocator_type, std::size_t _inline_capacity>
+    explicit compressed_bitmap(const array<bool, _allocator_type, _inline_capacity> &_array);
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the bitmap.
+     *
+     * @return The bitmap size.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the amount of true values.
+     *
+     * @return The cardinality of the bitmap.
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Returns the amount of bytes used by the containers.
+     *
+     * @return The memory usage without the bitmap object itself.
+     */
+    std::size_t memory_usage() const;
+
+    /**
+     * @brief Returns the amount of chunks saved in each kind of container.
+     *
+     * @param _sorted Receives the amount of sorted arrays.
+     * @param _dense Receives the amount of dense bitmaps.
+     * @param _runs Receives the amount of run lists.
+     */
+    void container_counts(std::size_t &_sorted, std::size_t &_dense, std::size_t &_runs) const;
+
+    /**
+     * @brief Returns the amount of values true in both bitmaps without
+     *        creating their intersection.
+     *
+     * @param _other The other bitmap, which has the same size.
+     * @return The cardinality of the intersection.
+     */
+    std::size_t intersection_count(const compressed_bitmap &_other) const;
+
+    /**
+     * @brief Returns the amount of values true in any of the bitmaps without
+     *        creating their union.
+     *
+     * @param _other The other bitmap, which has the same size.
+     * @return The cardinality of the union.
+     */
+    std::size_t union_count(const compressed_bitmap &_other) const;
+
+    /**
+     * @brief Decompresses the values into a bool array.
+     *
+     * @return The bool array.
+     */
+    template <typename _allocator_type = std::allocator<bool>>
+    array<bool, _allocator_type> to_array(const _allocator_type &_allocator = _allocator_type{}) const;
+
+  public: // Functionality
+    /**
+     * @brief Sets the value at a given index.
+     *
+     * Run lists are expanded when they are changed. Call optimize() after
+     * changing many values to compress them again.
+     *
+     * @param _index The index, which is smaller than size().
+     * @param _value The new value.
+     * @throws std::system_error if the index is not smaller than size().
+     */
+    void set(const std::size_t &_index, const bool &_value = true);
+
+    /**
+     * @brief Saves every chunk in its smallest container.
+     */
+    void optimize();
+
+  private: // Static functionality
+    /**
+     * @brief Returns the index of the container of a chunk in a sorted list.
+     *
+     * @return The index or the index the container would be inserted at.
+     */
+    static std::size_t find_container(const std::vector<container> &_containers, const std::size_t &_key);
+
+    /**
+     * @brief Creates the smallest container for the words of a dense bitmap.
+     *
+     * @param _key The index of the chunk.
+     * @param _words The 1024 words of the chunk.
+     * @return The container, whose cardinality might be zero.
+     */
+    static container from_words(const std::size_t &_key, std::vector<std::uint64_t> &&_words);
+
+    /**
+     * @brief Creates the smallest container for sorted values.
+     *
+     * @param _key The index of the chunk.
+     * @param _values The sorted values.
+     * @return The container, whose cardinality might be zero.
+     */
+    static container from_values(const std::size_t &_key, std::vector<std::uint16_t> &&_values);
+
+    /**
+     * @brief Creates the smallest container for a sorted list of runs.
+     *
+     * @param _key The index of the chunk.
+     * @param _runs The first and last value of every run, where runs neither
+     *              overlap nor touch.
+     * @return The container, whose cardinality might be zero.
+     */
+    static container from_runs(const std::size_t &_key, std::vector<std::uint16_t> &&_runs);
+
+    /**
+     * @brief Returns the first index of a bit with a given value in the words
+     *        of a chunk.
+     *
+     * @param _words The 1024 words of the chunk.
+     * @param _first The index the search starts at.
+     * @param _value The searched value.
+     * @return The index or chunk_size if there is none.
+     */
+    static std::size_t find_bit(const std::vector<std::uint64_t> &_words, const std::size_t &_first, const bool &_value);
+
+    /**
+     * @brief Sets the bits of a range in the words of a chunk.
+     *
+     * @param _words The 1024 words of the chunk.
+     * @param _first The first set index.
+     * @param _last The last set index.
+     */
+    static void fill_range(std::vector<std::uint64_t> &_words, const std::size_t &_first, const std::size_t &_last);
+
+    /**
+     * @brief Returns the sorted true values of a sorted array or run list.
+     */
+    static std::vector<std::uint16_t> to_values(const container &_container);
+
+    /**
+     * @brief Returns the words of a container as dense bitmap.
+     */
+    static std::vector<std::uint64_t> to_words(const container &_container);
+
+    /**
+     * @brief Checks whether a value is true in a container.
+     */
+    static bool contains(const container &_container, const std::uint16_t &_value);
+
+    /**
+     * @brief Intersects two containers of the same chunk.
+     */
+    static container intersect(const container &_left, const container &_right);
+
+    /**
+     * @brief Unites two containers of the same chunk.
+     */
+    static container unite(const container &_left, const container &_right);
+
+    /**
+     * @brief Counts the values true in both containers of the same chunk.
+     */
+    static std::size_t intersect_count(const container &_left, const container &_right);
+
+  public: // Operators
+    /**
+     * @brief Get the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the bitmap bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return The value at the given index.
+     */
+    bool operator[](const std::size_t &_index) const;
+
+    /**
+     * @brief Keeps only values that are true in both bitmaps.
+     *
+     * @param _other The other bitmap, which has the same size.
+     */
+    compressed_bitmap &operator&=(const compressed_bitmap &_other);
+
+    /**
+     * @brief Sets all values that are true in the other bitmap.
+     *
+     * @param _other The other bitmap, which has the same size.
+     */
+    compressed_bitmap &operator|=(const compressed_bitmap &_other);
+
+    /**
+     * @brief Returns the intersection of two bitmaps.
+     *
+     * @param _other The other bitmap, which has the same size.
+     */
+    compressed_bitmap operator&(const compressed_bitmap &_other) const;
+
+    /**
+     * @brief Returns the union of two bitmaps.
+     *
+     * @param _other The other bitmap, which has the same size.
+     */
+    compressed_bitmap operator|(const compressed_bitmap &_other) const;
+};
+
+#include "compressed_bitmap.tpp"
+
+#endif // COMPRESSED_BITMAP_HPP_
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+compressed_bitmap::compressed_bitmap(const array<bool, _allocator_type, _inline_capacity> &_array)
+    : m_size{_array.size()},
+      m_containers{}
+{
+    const typename array<bool, _allocator_type, _inline_capacity>::word_type *const words{_array.words()};
+    const std::size_t                                                             word_count{_array.word_count()};
+
+    for (std::size_t first{0}; first < word_count; first += s_chunk_word_size) {
+        const std::size_t last{std::min(first + s_chunk_word_size, word_count)};
+
+        // Chunks without true values are not saved at all.
+        if (std::all_of(words + first, words + last, [](const std::uint64_t &_word) { return _word == 0; })) {
+            continue;
+        }
+
+        std::vector<std::uint64_t> chunk(s_chunk_word_size, 0);
+        std::copy(words + first, words + last, chunk.begin());
+
+        m_containers.push_back(from_words(first / s_chunk_word_size, std::move(chunk)));
+    }
+}
+
+template <typename _allocator_type>
+array<bool, _allocator_type> compressed_bitmap::to_array(const _allocator_type &_allocator) const
+{
+    array<bool, _allocator_type> ret{m_size, _allocator};
+
+    typename array<bool, _allocator_type>::word_type *const words{ret.words()};
+    const std::size_t                                       word_count{ret.word_count()};
+
+    for (const container &current : m_containers) {
+        const std::size_t first{current.key * s_chunk_word_size};
+
+        // Containers behind the size are ignored, so the copy never exceeds
+        // the array.
+        if (first >= word_count) {
+            break;
+        }
+
+        const std::vector<std::uint64_t> chunk{to_words(current)};
+
+        std::copy(chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(std::min(s_chunk_word_size, word_count - first)), words + first);
+    }
+
+    return ret;
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <system_error>
+
+#include "compressed_bitmap.hpp"
+
+void print_bitmap(const char *_name, const compressed_bitmap &_bitmap)
+{
+    std::size_t sorted{0};
+    std::size_t dense{0};
+    std::size_t runs{0};
+    _bitmap.container_counts(sorted, dense, runs);
+
+    std::cout << _name << ": " << _bitmap.count() << " of " << _bitmap.size() << " values true in " << _bitmap.memory_usage()
+              << " bytes instead of " << (_bitmap.size() + 7) / 8 << " bytes (sorted " << sorted << ", dense " << dense << ", runs " << runs << ")\n";
+}
+
+int main()
+{
+    const std::size_t size{1 << 20};
+
+    // Every 1000th value is true, which is saved as sorted values.
+    array<bool> sparse_arr{size};
+    for (std::size_t i{0}; i < size; i += 1000) {
+        sparse_arr[i] = true;
+    }
+
+    // Long ranges of true values are saved as runs.
+    array<bool> runs_arr{size};
+    for (std::size_t i{0}; i < size; ++i) {
+        runs_arr[i] = (i / 50000) % 2 == 0;
+    }
+
+    // Every third value is true, which only fits a dense bitmap.
+    array<bool> dense_arr{size};
+    for (std::size_t i{0}; i < size; i += 3) {
+        dense_arr[i] = true;
+    }
+
+    const compressed_bitmap sparse{sparse_arr};
+    const compressed_bitmap runs{runs_arr};
+    const compressed_bitmap dense{dense_arr};
+
+    print_bitmap("Sparse", sparse);
+    print_bitmap("Runs", runs);
+    print_bitmap("Dense", dense);
+
+    print_bitmap("Sparse & runs", sparse & runs);
+    print_bitmap("Sparse | dense", sparse | dense);
+    print_bitmap("Runs & dense", runs & dense);
+
+    std::cout << "Intersection count: " << sparse.intersection_count(dense) << ", union count: " << sparse.union_count(runs) << '\n';
+
+    // Single values can be changed, too.
+    compressed_bitmap changed{runs};
+    changed.set(1);
+    changed.set(2, false);
+    changed.set(size - 1);
+    changed.optimize();
+    print_bitmap("Changed", changed);
+    std::cout << "Values: " << changed[0] << changed[1] << changed[2] << changed[size - 1] << '\n';
+
+    // Indices behind the size are rejected instead of growing the bitmap.
+    bool rejected{false};
+    try {
+        changed.set(size);
+    } catch (const std::system_error &) {
+        rejected = true;
+    }
+    std::cout << "Index behind the size rejected: " << rejected << '\n';
+
+    // Decompressing restores the original array.
+    const array<bool> restored_arr{(sparse | runs).to_array()};
+    bool              equal{true};
+    for (std::size_t i{0}; i < size; ++i) {
+        equal = equal && restored_arr[i] == (sparse_arr[i] || runs_arr[i]);
+    }
+    std::cout << "Round trip: " << (equal ? "equal" : "different") << '\n';
+
+    return equal && rejected ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "array.hpp"
+#include "concurrent_bit_array.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of mutexes guarding the words of the locked array.
+ */
+static const constexpr std::size_t s_shard_count{64};
+
+/**
+ * @brief Packed bool values guarded by one mutex per shard of words, as used
+ *        before the concurrent array existed.
+ *
+ * Changes through the proxy of array<bool> only touch the word of the value
+ * and drop the rank index with an atomic store, so the shards can write
+ * concurrently.
+ */
+struct sharded_bool_array {
+    array<bool>             values;
+    std::vector<std::mutex> mutexes;
+
+    explicit sharded_bool_array(const std::size_t &_size)
+        : values{_size},
+          mutexes(s_shard_count)
+    {
+    }
+
+    bool test_and_set(const std::size_t &_index)
+    {
+        const std::lock_guard<std::mutex> lock{mutexes[(_index / 64) % s_shard_count]};
+
+        const bool ret{values[_index]};
+        values[_index] = true;
+
+        return ret;
+    }
+};
+
+/**
+ * @brief Runs a function on multiple threads at once.
+ *
+ * @param _thread_count The amount of threads.
+ * @param _function The function, which gets the index of the thread.
+ * @return The time until all threads finished in ms.
+ */
+template <typename _function_type>
+double run_threads(const std::size_t &_thread_count, const _function_type &_function)
+{
+    std::latch               start{static_cast<std::ptrdiff_t>(_thread_count + 1)};
+    std::vector<std::thread> threads;
+    for (std::size_t i{0}; i < _thread_count; ++i) {
+        threads.emplace_back([&start, &_function, i]() {
+            start.arrive_and_wait();
+            _function(i);
+        });
+    }
+
+    const benchmark_clock::time_point begin{benchmark_clock::now()};
+    start.arrive_and_wait();
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    return std::chrono::duration<double, std::milli>{benchmark_clock::now() - begin}.count();
+}
+
+/**
+ * @brief Marks random values of an array from multiple threads.
+ *
+ * @param _array The marked array.
+ * @param _size The size of the array.
+ * @param _thread_count The amount of threads.
+ * @param _operations The amount of marked values per thread.
+ * @param _mark The marking function, which returns the previous value.
+ * @param _sum Receives the amount of newly marked values.
+ * @return The million marked values per second.
+ */
+template <typename _array_type, typename _mark_type>
+double benchmark_marking(_array_type &_array, const std::size_t &_size, const std::size_t &_thread_count, const std::size_t &_operations, const _mark_type &_mark, std::uint64_t &_sum)
+{
+    std::vector<std::uint64_t> marked(_thread_count * 8, 0);
+
+    const double elapsed{run_threads(_thread_count, [&](const std::size_t &_thread_index) {
+        std::uint64_t state{_thread_index + 1};
+        std::uint64_t count{0};
+
+        for (std::size_t i{0}; i < _operations; ++i) {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            count += _mark(_array, static_cast<std::size_t>((state >> 32) % _size)) ? 0 : 1;
+        }
+
+        // Every thread writes its own cache line.
+        marked[_thread_index * 8] = count;
+    })};
+
+    for (const std::uint64_t &count : marked) {
+        _sum += count;
+    }
+
+    return static_cast<double>(_thread_count * _operations) / elapsed / 1000;
+}
+
+/**
+ * @brief Compares all approaches for a given array size.
+ *
+ * A small array lets all threads contend for the same cache lines.
+ */
+void benchmark_size(const std::size_t &_size, const std::size_t &_max_threads, const std::size_t &_operations, std::uint64_t &_sum)
+{
+    std::cout << "size " << _size << "\nthreads | sharded mutexes | fetch_or | test_and_set (million marks/s)\n";
+
+    for (std::size_t thread_count{1}; thread_count <= _max_threads; thread_count *= 2) {
+        sharded_bool_array   sharded{_size};
+        concurrent_bit_array fetched{_size};
+        concurrent_bit_array tested{_size};
+
+        const double sharded_rate{benchmark_marking(sharded, _size, thread_count, _operations, [](sharded_bool_array &_array, const std::size_t &_index) { return _array.test_and_set(_index); }, _sum)};
+        const double fetched_rate{benchmark_marking(fetched, _size, thread_count, _operations, [](concurrent_bit_array &_array, const std::size_t &_index) {
+            const concurrent_bit_array::word_type mask{concurrent_bit_array::word_type{1} << (_index % 64)};
+            return (_array.fetch_or(_index / 64, mask, std::memory_order_acq_rel) & mask) != 0;
+        }, _sum)};
+        const double tested_rate{benchmark_marking(tested, _size, thread_count, _operations, [](concurrent_bit_array &_array, const std::size_t &_index) { return _array.test_and_set(_index, std::memory_order_acq_rel); }, _sum)};
+
+        std::cout << thread_count << " | " << sharded_rate << " | " << fetched_rate << " | " << tested_rate << '\n';
+    }
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of marked values per thread, the
+ * second one the largest amount of threads.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t operations{std::size_t{1} << 22};
+    if (_argc > 1) {
+        operations = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::size_t max_threads{std::max<std::size_t>(std::thread::hardware_concurrency(), 1)};
+    if (_argc > 2) {
+        max_threads = std::strtoull(_argv[2], nullptr, 10);
+    }
+
+    std::uint64_t sum{0};
+    benchmark_size(std::size_t{1} << 26, max_threads, operations, sum);
+    benchmark_size(std::size_t{1} << 12, max_threads, operations, sum);
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "concurrent_bit_array.hpp"
+
+#include <bit>
+
+concurrent_bit_array::concurrent_bit_array(const std::size_t &_size)
+    : m_size{_size},
+      m_words{std::make_unique<std::atomic<word_type>[]>((_size + word_bits - 1) / word_bits)}
+{
+}
+
+std::size_t concurrent_bit_array::size() const
+{
+    return m_size;
+}
+
+std::size_t concurrent_bit_array::word_count() const
+{
+    return (m_size + word_bits - 1) / word_bits;
+}
+
+bool concurrent_bit_array::test(const std::size_t &_index, const std::memory_order &_order) const
+{
+    return (m_words[_index / word_bits].load(_order) >> (_index % word_bits)) & 1;
+}
+
+concurrent_bit_array::word_type concurrent_bit_array::load_word(const std::size_t &_word_index, const std::memory_order &_order) const
+{
+    return m_words[_word_index].load(_order);
+}
+
+std::size_t concurrent_bit_array::count() const
+{
+    std::size_t ret{0};
+    for (std::size_t i{0}; i < word_count(); ++i) {
+        ret += static_cast<std::size_t>(std::popcount(m_words[i].load(std::memory_order_relaxed)));
+    }
+
+    return ret;
+}
+
+bool concurrent_bit_array::test_and_set(const std::size_t &_index, const std::memory_order &_order)
+{
+    std::atomic<word_type> &word{m_words[_index / word_bits]};
+    const word_type         mask{word_type{1} << (_index % word_bits)};
+
+    // The load synchronizes with the thread that set the value, as fetch_or
+    // would, but it does not need exclusive access to the cache line.
+    const std::memory_order load_order{_order == std::memory_order_release ? std::memory_order_relaxed : (_order == std::memory_order_acq_rel ? std::memory_order_acquire : _order)};
+    if (word.load(load_order) & mask) {
+        return true;
+    }
+
+    return word.fetch_or(mask, _order) & mask;
+}
+
+bool concurrent_bit_array::test_and_reset(const std::size_t &_index, const std::memory_order &_order)
+{
+    const word_type mask{word_type{1} << (_index % word_bits)};
+
+    return m_words[_index / word_bits].fetch_and(~mask, _order) & mask;
+}
+
+concurrent_bit_array::word_type concurrent_bit_array::fetch_or(const std::size_t &_word_index, const word_type &_mask, const std::memory_order &_order)
+{
+    return m_words[_word_index].fetch_or(_mask & valid_bits(_word_index), _order);
+}
+
+concurrent_bit_array::word_type concurrent_bit_array::fetch_and(const std::size_t &_word_index, const word_type &_mask, const std::memory_order &_order)
+{
+    return m_words[_word_index].fetch_and(_mask, _order);
+}
+
+void concurrent_bit_array::clear()
+{
+    for (std::size_t i{0}; i < word_count(); ++i) {
+        m_words[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+concurrent_bit_array::word_type concurrent_bit_array::valid_bits(const std::size_t &_word_index) const
+{
+    const std::size_t used_bits{_word_index + 1 < word_count() ? word_bits : m_size - _word_index * word_bits};
+
+    return used_bits == word_bits ? ~word_type{0} : (word_type{1} << used_bits) - 1;
+}
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef CONCURRENT_BIT_ARRAY_HPP_
+#define CONCURRENT_BIT_ARRAY_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "array.hpp"
+
+/**
+ * @brief A class implementing an array of bool values, which can be changed
+ *        by multiple threads at once.
+ *
+ * The values are packed into 64 bit words with the same layout as the words
+ * of array<bool>. Every change is an atomic operation on the word containing
+ * the value, so threads changing neighbouring values do not lose updates and
+ * no locks are needed.
+ */
+class concurrent_bit_array {
+  public: // Typedefs
+    /**
+     * @brief The type of the words the values are packed into.
+     */
+    typedef std::uint64_t word_type;
+
+  private: // Member variables
+    /**
+     * @brief The amount of values.
+     */
+    std::size_t m_size;
+
+    /**
+     * @brief The words the values are packed into.
+     */
+    std::unique_ptr<std::atomic<word_type>[]> m_words;
+
+  public: // Static members
+    /**
+     * @brief The amount of values per word.
+     */
+    static const constexpr std::size_t word_bits{64};
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an array of a given size with all values being false.
+     *
+     * @param _size The size of the array.
+     */
+    explicit concurrent_bit_array(const std::size_t &_size);
+
+    /**
+     * @brief Copies the values of a bool array.
+     *
+     * @param _array The copied array.
+     */
+    template <typename _allocator_type, std::size_t _inline_capacity>
+    explicit concurrent_bit_array(const array<bool, _allocator_type, _inline_capacity> &_array);
+
+    /**
+     * @brief Concurrent arrays are shared by reference, so copying is not
+     *        allowed.
+     */
+    concurrent_bit_array(const concurrent_bit_array &) = delete;
+
+    /**
+     * @brief Concurrent arrays are shared by reference, so copying is not
+     *        allowed.
+     */
+    concurrent_bit_array &operator=(const concurrent_bit_array &) = delete;
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     *
+     * @return The array size.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the amount of words the values are packed into.
+     *
+     * @return The amount of words.
+     */
+    std::size_t word_count() const;
+
+    /**
+     * @brief Returns the value at a given index.
+     *
+     * @param _index The index, which is smaller than size().
+     * @param _order The memory order of the load.
+     * @return The value at the given index.
+     */
+    bool test(const std::size_t &_index, const std::memory_order &_order = std::memory_order_seq_cst) const;
+
+    /**
+     * @brief Returns the word at a given word index.
+     *
+     * @param _word_index The index of the word, which is smaller than
+     *                    word_count().
+     * @param _order The memory order of the load.
+     * @return The word.
+     */
+    word_type load_word(const std::size_t &_word_index, const std::memory_order &_order = std::memory_order_seq_cst) const;
+
+    /**
+     * @brief Returns the amount of true values.
+     *
+     * The words are loaded one after another with relaxed memory order, so
+     * values changed during the call might or might not be counted.
+     *
+     * @return The amount of true values.
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Copies the values into a bool array.
+     *
+     * The words are loaded with relaxed memory order, see count().
+     *
+     * @return The bool array.
+     */
+    template <typename _allocator_type = std::allocator<bool>>
+    array<bool, _allocator_type> to_array(const _allocator_type &_allocator = _allocator_type{}) const;
+
+  public: // Functionality
+    /**
+     * @brief Sets the value at a given index to true.
+     *
+     * The word is loaded first, so already set values do not take the cache
+     * line away from other threads. This makes repeatedly marking the same
+     * values, e.g. the visited set of a graph traversal, scale with the
+     * amount of threads.
+     *
+     * @param _index The index, which is smaller than size().
+     * @param _order The memory order of the change.
+     * @return The previous value, so exactly one thread gets false.
+     */
+    bool test_and_set(const std::size_t &_index, const std::memory_order &_order = std::memory_order_seq_cst);
+
+    /**
+     * @brief Sets the value at a given index to false.
+     *
+     * @param _index The index, which is smaller than size().
+     * @param _order The memory order of the change.
+     * @return The previous value, so exactly one thread gets true.
+     */
+    bool test_and_reset(const std::size_t &_index, const std::memory_order &_order = std::memory_order_seq_cst);
+
+    /**
+     * @brief Sets the bits of a mask in a word.
+     *
+     * @param _word_index The index of the word, which is smaller than
+     *                    word_count().
+     * @param _mask The set bits. Bits behind the last value are ignored, so
+     *              they stay zero.
+     * @param _order The memory order of the change.
+     * @return The previous word.
+     */
+    word_type fetch_or(const std::size_t &_word_index, const word_type &_mask, const std::memory_order &_order = std::memory_order_seq_cst);
+
+    /**
+     * @brief Keeps only the bits of a mask in a word.
+     *
+     * @param _word_index The index of the word, which is smaller than
+     *                    word_count().
+     * @param _mask The kept bits.
+     * @param _order The memory order of the change.
+     * @return The previous word.
+     */
+    word_type fetch_and(const std::size_t &_word_index, const word_type &_mask, const std::memory_order &_order = std::memory_order_seq_cst);
+
+    /**
+     * @brief Sets all values to false.
+     *
+     * Every word is cleared atomically, but not all words at once.
+     */
+    void clear();
+
+  private: // Functionality
+    /**
+     * @brief Returns the bits of a word, which belong to values of the array.
+     *
+     * @param _word_index The index of the word, which is smaller than
+     *                    word_count().
+     * @return All bits for every word except a partially used last word.
+     */
+    word_type valid_bits(const std::size_t &_word_index) const;
+};
+
+#include "concurrent_bit_array.tpp"
+
+#endif // CONCURRENT_BIT_ARRAY_HPP_
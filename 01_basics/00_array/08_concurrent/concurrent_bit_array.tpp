@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+template <typename _allocator_type, std::size_t _inline_capacity>
+concurrent_bit_array::concurrent_bit_array(const array<bool, _allocator_type, _inline_capacity> &_array)
+    : concurrent_bit_array{_array.size()}
+{
+    const typename array<bool, _allocator_type, _inline_capacity>::word_type *const words{_array.words()};
+
+    for (std::size_t i{0}; i < word_count(); ++i) {
+        m_words[i].store(words[i], std::memory_order_relaxed);
+    }
+}
+
+template <typename _allocator_type>
+array<bool, _allocator_type> concurrent_bit_array::to_array(const _allocator_type &_allocator) const
+{
+    array<bool, _allocator_type> ret{m_size, _allocator};
+
+    typename array<bool, _allocator_type>::word_type *const words{ret.words()};
+    for (std::size_t i{0}; i < word_count(); ++i) {
+        words[i] = m_words[i].load(std::memory_order_relaxed);
+    }
+
+    return ret;
+}
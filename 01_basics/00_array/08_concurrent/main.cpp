@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "concurrent_bit_array.hpp"
+
+int main()
+{
+    const std::size_t size{100000};
+    const std::size_t thread_count{4};
+
+    // Every thread tries to mark every value, each in a different order.
+    // Exactly one thread wins each value, even for neighbouring values.
+    concurrent_bit_array     visited{size};
+    std::vector<std::size_t> marked(thread_count, 0);
+    {
+        std::vector<std::thread> threads;
+        for (std::size_t i{0}; i < thread_count; ++i) {
+            threads.emplace_back([&visited, &marked, i, size]() {
+                for (std::size_t j{0}; j < size; ++j) {
+                    if (!visited.test_and_set((j * (2 * i + 1) + i) % size, std::memory_order_relaxed)) {
+                        ++marked[i];
+                    }
+                }
+            });
+        }
+
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::size_t total{0};
+    std::cout << "Marked per thread:";
+    for (const std::size_t &count : marked) {
+        std::cout << ' ' << count;
+        total += count;
+    }
+    std::cout << " (total " << total << ", count " << visited.count() << " of " << visited.size() << ")\n";
+
+    // Whole words are changed at once and snapshots are ordinary bool arrays.
+    // Bits of a mask behind the last value are ignored.
+    array<bool> bool_arr{11};
+    bool_arr[1] = true;
+    bool_arr[4] = true;
+
+    concurrent_bit_array flags{bool_arr};
+    flags.fetch_or(0, 0b1000000001 | (concurrent_bit_array::word_type{1} << bool_arr.size()));
+    flags.test_and_reset(4);
+
+    const array<bool> snapshot_arr{flags.to_array()};
+    std::cout << "Snapshot: [";
+    for (std::size_t i{0}; i < snapshot_arr.size(); ++i) {
+        std::cout << ' ' << snapshot_arr[i];
+    }
+    std::cout << " ]\n";
+
+    return total == size && visited.count() == size && flags.count() == 3 ? 0 : 1;
+}
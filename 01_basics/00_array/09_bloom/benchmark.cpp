@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "blocked_bloom_filter.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of bits per key of all filters.
+ */
+static const constexpr double s_bits_per_key{10};
+
+/**
+ * @brief A classic Bloom filter, whose bits of a key are spread over the
+ *        whole bool array.
+ */
+class classic_bloom_filter {
+  private: // Member variables
+    array<bool> m_bits;
+    std::size_t m_hash_count;
+
+  public: // Constructors and destructor
+    explicit classic_bloom_filter(const std::size_t &_key_count)
+        : m_bits{static_cast<std::size_t>(static_cast<double>(_key_count) * s_bits_per_key)},
+          m_hash_count{static_cast<std::size_t>(std::round(s_bits_per_key * std::log(2.0)))}
+    {
+    }
+
+  public: // Getter
+    bool contains(const std::uint64_t &_key) const
+    {
+        const std::uint64_t key_hash{hash(_key)};
+
+        for (std::size_t i{0}; i < m_hash_count; ++i) {
+            const std::size_t index{bit_index(key_hash, i)};
+
+            if (!((m_bits.words()[index / 64] >> (index % 64)) & 1)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+  public: // Functionality
+    void insert(const std::uint64_t &_key)
+    {
+        const std::uint64_t key_hash{hash(_key)};
+
+        for (std::size_t i{0}; i < m_hash_count; ++i) {
+            const std::size_t index{bit_index(key_hash, i)};
+            m_bits.words()[index / 64] |= std::uint64_t{1} << (index % 64);
+        }
+    }
+
+  private: // Functionality
+    static std::uint64_t hash(std::uint64_t _key)
+    {
+        _key ^= _key >> 33;
+        _key *= 0xff51afd7ed558ccdu;
+        _key ^= _key >> 33;
+        _key *= 0xc4ceb9fe1a85ec53u;
+        _key ^= _key >> 33;
+
+        return _key;
+    }
+
+    /**
+     * @brief Derives the bits of a key from two halves of its hash.
+     */
+    std::size_t bit_index(const std::uint64_t &_hash, const std::size_t &_index) const
+    {
+        const std::uint32_t combined{static_cast<std::uint32_t>(_hash + _index * ((_hash >> 32) | 1))};
+
+        return static_cast<std::size_t>((std::uint64_t{combined} * m_bits.size()) >> 32);
+    }
+};
+
+/**
+ * @brief Returns the time per key of a function in ns.
+ */
+template <typename _function_type>
+double measure(const std::size_t &_key_count, const _function_type &_function)
+{
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+    _function();
+
+    return std::chrono::duration<double, std::nano>{benchmark_clock::now() - start}.count() / static_cast<double>(_key_count);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of inserted keys.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t key_count{std::size_t{1} << 23};
+    if (_argc > 1) {
+        key_count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    // The inserted keys and the checked keys, which were never inserted.
+    std::vector<std::uint64_t> keys(key_count);
+    std::vector<std::uint64_t> other_keys(key_count);
+    std::uint64_t              state{42};
+    for (std::size_t i{0}; i < key_count; ++i) {
+        state         = state * 6364136223846793005u + 1442695040888963407u;
+        keys[i]       = state | 1;
+        other_keys[i] = state & ~std::uint64_t{1};
+    }
+
+    classic_bloom_filter                classic{key_count};
+    blocked_bloom_filter<std::uint64_t> blocked{key_count, s_bits_per_key};
+
+    const double classic_insert{measure(key_count, [&]() {
+        for (const std::uint64_t &key : keys) {
+            classic.insert(key);
+        }
+    })};
+    const double blocked_insert{measure(key_count, [&]() {
+        for (const std::uint64_t &key : keys) {
+            blocked.insert(key);
+        }
+    })};
+
+    std::size_t  classic_positives{0};
+    std::size_t  blocked_positives{0};
+    std::size_t  batched_positives{0};
+    const double classic_contains{measure(key_count, [&]() {
+        for (const std::uint64_t &key : other_keys) {
+            classic_positives += classic.contains(key) ? 1 : 0;
+        }
+    })};
+    const double blocked_contains{measure(key_count, [&]() {
+        for (const std::uint64_t &key : other_keys) {
+            blocked_positives += blocked.contains(key) ? 1 : 0;
+        }
+    })};
+
+    const std::unique_ptr<bool[]> results{std::make_unique<bool[]>(key_count)};
+    const double                  batched_contains{measure(key_count, [&]() { batched_positives = blocked.contains_many(other_keys.data(), key_count, results.get()); })};
+
+    std::cout << key_count << " keys, " << s_bits_per_key << " bits per key\n"
+              << "filter | insert ns | contains ns | false positive rate %\n"
+              << "classic | " << classic_insert << " | " << classic_contains << " | " << 100.0 * static_cast<double>(classic_positives) / static_cast<double>(key_count) << '\n'
+              << "blocked | " << blocked_insert << " | " << blocked_contains << " | " << 100.0 * static_cast<double>(blocked_positives) / static_cast<double>(key_count) << '\n'
+              << "blocked contains_many | - | " << batched_contains << " | " << 100.0 * static_cast<double>(batched_positives) / static_cast<double>(key_count) << '\n';
+
+    return 0;
+}
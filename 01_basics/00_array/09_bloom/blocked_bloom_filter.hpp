@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef BLOCKED_BLOOM_FILTER_HPP_
+#define BLOCKED_BLOOM_FILTER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "aligned_allocator.hpp"
+#include "array.hpp"
+
+/**
+ * @brief A class implementing a Bloom filter, where every key only touches a
+ *        single cache line.
+ *
+ * The bits are saved in a bool array, whose words are split into blocks of
+ * 64 bytes. A key selects one block and sets one bit in each of its eight
+ * words, so every lookup costs at most one cache miss. The eight bits are
+ * computed and checked with the same branch-free operation on every word,
+ * which compilers can turn into vector instructions.
+ *
+ * Blocking slightly increases the false positive rate compared to a classic
+ * Bloom filter with the same amount of bits.
+ */
+template <typename _key_type, typename _hash_type = std::hash<_key_type>, typename _allocator_type = aligned_allocator<bool>>
+class blocked_bloom_filter {
+  public: // Typedefs
+    typedef _key_type       key_type;
+    typedef _hash_type      hash_type;
+    typedef _allocator_type allocator_type;
+
+    /**
+     * @brief The array the bits are saved in.
+     */
+    typedef array<bool, allocator_type> bits_type;
+
+    /**
+     * @brief The type of the words of the bits.
+     */
+    typedef typename bits_type::word_type word_type;
+
+  public: // Static members
+    /**
+     * @brief The amount of words per block.
+     */
+    static const constexpr std::size_t block_words{8};
+
+    /**
+     * @brief The amount of bits per block, which fill a cache line.
+     */
+    static const constexpr std::size_t block_bits{block_words * 64};
+
+  private: // Static members
+    /**
+     * @brief Odd factors deriving the bit of every word from the same hash.
+     */
+    static const constexpr std::array<std::uint32_t, block_words> s_salts{0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+    /**
+     * @brief The amount of keys hashed ahead in contains_many().
+     */
+    static const constexpr std::size_t s_batch_size{16};
+
+  private: // Member variables
+    /**
+     * @brief The hash function.
+     */
+    hash_type m_hash;
+
+    /**
+     * @brief The bits of all blocks.
+     */
+    bits_type m_bits;
+
+    /**
+     * @brief The amount of blocks.
+     */
+    std::size_t m_block_count;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an empty filter for a given amount of keys.
+     *
+     * @param _key_count The expected amount of keys.
+     * @param _bits_per_key The amount of bits per key, 10 bits result in a
+     *                      false positive rate of about 1 %.
+     * @param _hash The hash function.
+     * @param _allocator The allocator of the bits.
+     */
+    explicit blocked_bloom_filter(const std::size_t &_key_count, const double &_bits_per_key = 10, const hash_type &_hash = hash_type{}, const allocator_type &_allocator = allocator_type{});
+
+    /**
+     * @brief Creates a filter from previously saved bits.
+     *
+     * @param _bits The bits, whose size is a nonzero multiple of block_bits.
+     * @param _hash The hash function, which has to be the one used to create
+     *              the bits.
+     * @throws std::system_error if the size is invalid.
+     */
+    explicit blocked_bloom_filter(bits_type &&_bits, const hash_type &_hash = hash_type{});
+
+  public: // Getter
+    /**
+     * @brief Returns the amount of blocks.
+     *
+     * @return The amount of blocks.
+     */
+    std::size_t block_count() const;
+
+    /**
+     * @brief Returns the bits of the filter, e.g. to save their words.
+     *
+     * @return The bits.
+     */
+    const bits_type &bits() const;
+
+    /**
+     * @brief Checks whether a key might have been inserted.
+     *
+     * @param _key The key.
+     * @return False if the key has never been inserted, true if it probably
+     *         has been inserted.
+     */
+    bool contains(const key_type &_key) const;
+
+    /**
+     * @brief Checks many keys at once.
+     *
+     * The keys are hashed in batches and the blocks of a batch are prefetched
+     * before they are checked, so the cache misses of multiple keys overlap.
+     *
+     * @param _keys The checked keys.
+     * @param _count The amount of keys.
+     * @param _results Receives the result of contains() for every key.
+     * @return The amount of keys that might have been inserted.
+     */
+    std::size_t contains_many(const key_type *_keys, const std::size_t &_count, bool *_results) const;
+
+  public: // Functionality
+    /**
+     * @brief Inserts a key.
+     *
+     * @param _key The key.
+     */
+    void insert(const key_type &_key);
+
+    /**
+     * @brief Removes all keys.
+     */
+    void clear();
+
+  private: // Functionality
+    /**
+     * @brief Returns the hash of a key.
+     *
+     * The result of the hash function is mixed, as e.g. integer keys are
+     * their own hash.
+     */
+    std::uint64_t hash(const key_type &_key) const;
+
+    /**
+     * @brief Returns the index of the first word of the block of a hash.
+     */
+    std::size_t block_index(const std::uint64_t &_hash) const;
+
+    /**
+     * @brief Checks whether all bits of a hash are set in its block.
+     */
+    bool contains_hash(const std::uint64_t &_hash, const std::size_t &_block_index) const;
+};
+
+#include "blocked_bloom_filter.tpp"
+
+#endif // BLOCKED_BLOOM_FILTER_HPP_
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <system_error>
+#include <utility>
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::blocked_bloom_filter(const std::size_t &_key_count, const double &_bits_per_key, const hash_type &_hash, const allocator_type &_allocator)
+    : m_hash{_hash},
+      m_bits{std::max<std::size_t>(static_cast<std::size_t>(std::ceil(static_cast<double>(_key_count) * _bits_per_key / block_bits)), 1) * block_bits, _allocator},
+      m_block_count{m_bits.size() / block_bits}
+{
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::blocked_bloom_filter(bits_type &&_bits, const hash_type &_hash)
+    : m_hash{_hash},
+      m_bits{std::move(_bits)},
+      m_block_count{m_bits.size() / block_bits}
+{
+    if (m_block_count == 0 || m_bits.size() % block_bits != 0) {
+        throw std::system_error{std::make_error_code(std::errc::invalid_argument), "blocked_bloom_filter size"};
+    }
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+std::size_t blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::block_count() const
+{
+    return m_block_count;
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+const typename blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::bits_type &blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::bits() const
+{
+    return m_bits;
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+bool blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::contains(const key_type &_key) const
+{
+    const std::uint64_t key_hash{hash(_key)};
+
+    return contains_hash(key_hash, block_index(key_hash));
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+std::size_t blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::contains_many(const key_type *_keys, const std::size_t &_count, bool *_results) const
+{
+    std::size_t ret{0};
+
+    std::uint64_t hashes[s_batch_size];
+    std::size_t   indices[s_batch_size];
+
+    for (std::size_t first{0}; first < _count; first += s_batch_size) {
+        const std::size_t batch_size{std::min(s_batch_size, _count - first)};
+
+        for (std::size_t i{0}; i < batch_size; ++i) {
+            hashes[i]  = hash(_keys[first + i]);
+            indices[i] = block_index(hashes[i]);
+
+#if defined(__GNUC__)
+            __builtin_prefetch(m_bits.words() + indices[i]);
+#endif
+        }
+
+        for (std::size_t i{0}; i < batch_size; ++i) {
+            _results[first + i] = contains_hash(hashes[i], indices[i]);
+            ret += _results[first + i] ? 1 : 0;
+        }
+    }
+
+    return ret;
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+void blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::insert(const key_type &_key)
+{
+    const std::uint64_t key_hash{hash(_key)};
+    const std::uint32_t lane_hash{static_cast<std::uint32_t>(key_hash)};
+
+    word_type *const block{m_bits.words() + block_index(key_hash)};
+    for (std::size_t i{0}; i < block_words; ++i) {
+        block[i] |= word_type{1} << ((lane_hash * s_salts[i]) >> 26);
+    }
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+void blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::clear()
+{
+    std::fill(m_bits.words(), m_bits.words() + m_bits.word_count(), word_type{0});
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+std::uint64_t blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::hash(const key_type &_key) const
+{
+    // Finalizer of MurmurHash3, which lets every input bit affect all output
+    // bits.
+    std::uint64_t ret{static_cast<std::uint64_t>(m_hash(_key))};
+    ret ^= ret >> 33;
+    ret *= 0xff51afd7ed558ccdu;
+    ret ^= ret >> 33;
+    ret *= 0xc4ceb9fe1a85ec53u;
+    ret ^= ret >> 33;
+
+    return ret;
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+std::size_t blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::block_index(const std::uint64_t &_hash) const
+{
+    // Maps the upper half of the hash to a block without a division.
+    return static_cast<std::size_t>(((_hash >> 32) * m_block_count) >> 32) * block_words;
+}
+
+template <typename _key_type, typename _hash_type, typename _allocator_type>
+bool blocked_bloom_filter<_key_type, _hash_type, _allocator_type>::contains_hash(const std::uint64_t &_hash, const std::size_t &_block_index) const
+{
+    const std::uint32_t    lane_hash{static_cast<std::uint32_t>(_hash)};
+    const word_type *const block{m_bits.words() + _block_index};
+
+    // All words are checked without branching on single bits.
+    word_type missing{0};
+    for (std::size_t i{0}; i < block_words; ++i) {
+        missing |= ~block[i] & (word_type{1} << ((lane_hash * s_salts[i]) >> 26));
+    }
+
+    return missing == 0;
+}
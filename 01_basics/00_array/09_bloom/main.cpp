@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "blocked_bloom_filter.hpp"
+
+int main()
+{
+    const std::uint64_t key_count{100000};
+
+    blocked_bloom_filter<std::uint64_t> filter{key_count};
+    for (std::uint64_t key{0}; key < key_count; ++key) {
+        filter.insert(key * 2);
+    }
+
+    // Inserted keys are always found, other keys only rarely.
+    std::uint64_t found{0};
+    std::uint64_t false_positives{0};
+    for (std::uint64_t key{0}; key < key_count; ++key) {
+        found += filter.contains(key * 2) ? 1 : 0;
+        false_positives += filter.contains(key * 2 + 1) ? 1 : 0;
+    }
+
+    std::cout << filter.block_count() << " blocks, found " << found << " of " << key_count << ", false positive rate "
+              << 100.0 * static_cast<double>(false_positives) / static_cast<double>(key_count) << " %\n";
+
+    // The words of the bits are written and read as they are.
+    std::stringstream stream{};
+    stream.write(reinterpret_cast<const char *>(filter.bits().words()), static_cast<std::streamsize>(filter.bits().word_count() * sizeof(std::uint64_t)));
+
+    blocked_bloom_filter<std::uint64_t>::bits_type bits{filter.bits().size()};
+    stream.read(reinterpret_cast<char *>(bits.words()), static_cast<std::streamsize>(bits.word_count() * sizeof(std::uint64_t)));
+
+    const blocked_bloom_filter<std::uint64_t> loaded{std::move(bits)};
+
+    // Batches of keys are checked with prefetched blocks.
+    std::uint64_t keys[10];
+    bool          results[10];
+    for (std::uint64_t i{0}; i < 10; ++i) {
+        keys[i] = i;
+    }
+
+    std::cout << "Loaded filter contains " << loaded.contains_many(keys, 10, results) << " of 10 keys:";
+    for (const bool &result : results) {
+        std::cout << ' ' << result;
+    }
+    std::cout << '\n';
+
+    // Any hashable key type can be used.
+    blocked_bloom_filter<std::string> names{3};
+    names.insert("array");
+    names.insert("bloom");
+    std::cout << "Names: " << names.contains("array") << names.contains("bloom") << names.contains("filter") << '\n';
+
+    return found == key_count && results[0] && results[2] ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "cow_array.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of stages every array is passed to.
+ */
+static const constexpr std::size_t s_stage_count{8};
+
+/**
+ * @brief A stage reading a single value of the array it gets by value.
+ */
+template <typename _array_type>
+double read_stage(const _array_type _arr, const std::size_t &_index)
+{
+    return std::as_const(_arr)[_index % _arr.size()];
+}
+
+/**
+ * @brief A stage changing a single value of the array it gets by value.
+ */
+template <typename _array_type>
+double write_stage(_array_type _arr, const std::size_t &_index)
+{
+    _arr[_index % _arr.size()] += 1.0;
+
+    return _arr[_index % _arr.size()];
+}
+
+/**
+ * @brief Passes an array to all stages a given amount of times.
+ *
+ * @param _arr The array.
+ * @param _count The amount of passes.
+ * @param _stage The stage function.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @return The time per stage in us.
+ */
+template <typename _array_type, typename _stage_type>
+double benchmark_stages(const _array_type &_arr, const std::size_t &_count, const _stage_type &_stage, double &_sum)
+{
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::size_t i{0}; i < _count; ++i) {
+        for (std::size_t j{0}; j < s_stage_count; ++j) {
+            _sum += _stage(_arr, i * s_stage_count + j);
+        }
+    }
+
+    const std::chrono::duration<double, std::micro> elapsed{benchmark_clock::now() - start};
+
+    return elapsed.count() / static_cast<double>(_count * s_stage_count);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of passes per size.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t count{20};
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::cout << "size | array read us | cow read us | array write us | cow write us\n";
+
+    double sum{0};
+    for (std::size_t size{std::size_t{1} << 10}; size <= std::size_t{1} << 22; size <<= 4) {
+        array<double> values{size};
+        for (std::size_t i{0}; i < size; ++i) {
+            values[i] = static_cast<double>(i);
+        }
+
+        const cow_array<double> shared{array<double>{values}};
+
+        const double array_read{benchmark_stages(values, count, read_stage<array<double>>, sum)};
+        const double cow_read{benchmark_stages(shared, count, read_stage<cow_array<double>>, sum)};
+        const double array_write{benchmark_stages(values, count, write_stage<array<double>>, sum)};
+        const double cow_write{benchmark_stages(shared, count, write_stage<cow_array<double>>, sum)};
+
+        std::cout << size << " | " << array_read << " | " << cow_read << " | " << array_write << " | " << cow_write << '\n';
+    }
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
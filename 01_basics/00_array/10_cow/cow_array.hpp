@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef COW_ARRAY_HPP_
+#define COW_ARRAY_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "array.hpp"
+
+/**
+ * @brief A class implementing a dynamic array, whose copies share their values
+ *        until one of them is changed.
+ *
+ * The values are saved in an array inside a reference counted buffer. Copying
+ * only increments the reference count, so passing large arrays by value costs
+ * the same for every size. The first change through a copy, i.e. a mutable
+ * operator[], data() or resize(), copies the values into a buffer of its own.
+ * Once a mutable reference or pointer was handed out, the buffer is no longer
+ * shared, so later copies copy the values and changes through the reference
+ * never show up in them.
+ *
+ * Like std::shared_ptr, arrays sharing a buffer may be used by different
+ * threads, as the reference count is atomic. A single array object must not
+ * be changed by one thread while it is used by another one.
+ */
+template <typename _content_type, typename _allocator_type = std::allocator<_content_type>>
+class cow_array {
+  public: // Typedefs
+    /**
+     * @brief The content_type saved in this array
+     */
+    typedef _content_type content_type;
+
+    /**
+     * @brief The allocator used for the values and the shared buffer.
+     */
+    typedef _allocator_type allocator_type;
+
+    /**
+     * @brief The array the values are saved in.
+     */
+    typedef array<content_type, allocator_type> array_type;
+
+  private: // Classes
+    /**
+     * @brief The values shared by all copies together with their amount.
+     */
+    struct shared_buffer {
+        /**
+         * @brief The amount of arrays sharing the buffer.
+         */
+        std::atomic<std::size_t> references;
+
+        /**
+         * @brief Whether copies may share the buffer, which is reset once a
+         *        mutable reference or pointer to the values was handed out.
+         *
+         * Only changed by the single array referencing the buffer.
+         */
+        bool shareable;
+
+        /**
+         * @brief The shared values.
+         */
+        array_type values;
+    };
+
+  private: // Typedefs
+    typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<shared_buffer> buffer_allocator_type;
+    typedef std::allocator_traits<buffer_allocator_type>                                       buffer_allocator_traits;
+
+  private: // Member variables
+    /**
+     * @brief The allocator used for the shared buffer.
+     */
+    buffer_allocator_type m_allocator;
+
+    /**
+     * @brief The shared buffer, which is null for moved-from arrays.
+     */
+    shared_buffer *m_buffer;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an array of a given size.
+     *
+     * @param _size The size of the array.
+     * @param _allocator The allocator used for the values and the shared
+     *                   buffer.
+     */
+    explicit cow_array(const std::size_t &_size, const allocator_type &_allocator = allocator_type{});
+
+    /**
+     * @brief Takes over the values of an array.
+     *
+     * Heap memory of the array is taken over without copying the values.
+     *
+     * @param _values The values.
+     */
+    explicit cow_array(array_type &&_values);
+
+    /**
+     * @brief Copy constructor, which shares the values of the other array.
+     *
+     * The values are copied if a mutable reference or pointer to them was
+     * handed out.
+     */
+    cow_array(const cow_array<content_type, allocator_type> &_other);
+
+    /**
+     * @brief Move constructor, which leaves the other array empty.
+     */
+    cow_array(cow_array<content_type, allocator_type> &&_other);
+
+    /**
+     * @brief Releases the shared buffer and frees it if it was the last
+     *        reference.
+     */
+    ~cow_array();
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     *
+     * @return The array size.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the amount of arrays sharing the values.
+     *
+     * @return The amount of arrays or zero for moved-from arrays.
+     */
+    std::size_t use_count() const;
+
+    /**
+     * @brief Returns a pointer to the values without copying them.
+     */
+    const content_type *data() const;
+
+    /**
+     * @brief Returns a pointer to the values, which are copied first if they
+     *        are shared.
+     *
+     * The values are no longer shared by later copies.
+     */
+    content_type *data();
+
+  public: // Functionality
+    /**
+     * @brief Changes the size of the array, the values are copied first if
+     *        they are shared.
+     *
+     * @param _size The new size.
+     */
+    void resize(const std::size_t &_size);
+
+  private: // Functionality
+    /**
+     * @brief Creates a buffer, which is only referenced by this array.
+     *
+     * @param _values The values of the buffer.
+     * @return The buffer.
+     */
+    shared_buffer *create_buffer(array_type &&_values);
+
+    /**
+     * @brief Releases the shared buffer.
+     */
+    void release();
+
+    /**
+     * @brief Copies the values into a buffer of its own if they are shared.
+     */
+    void detach();
+
+    /**
+     * @brief Copies the values into a buffer of its own if they are shared
+     *        and stops sharing them with later copies.
+     *
+     * Called before a mutable reference or pointer is handed out.
+     */
+    void detach_unshareable();
+
+  public: // Operators
+    /**
+     * @brief Get the value at a given index without copying the values.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return Constant reference to the value at the given index.
+     */
+    const content_type &operator[](const std::size_t &_index) const;
+
+    /**
+     * @brief Get a changeable reference to the value at a given index.
+     *
+     * The values are copied first if they are shared, even if the value is
+     * only read. Use a constant reference, e.g. std::as_const, to read shared
+     * values without copying them. The values are no longer shared by later
+     * copies, so changes through the reference stay in this array.
+     *
+     * @param _index The index that should be accessed.
+     * @return Reference to the value at the given index.
+     */
+    content_type &operator[](const std::size_t &_index);
+
+    /**
+     * @brief Copy assignment operator, which shares the values of the other
+     *        array like the copy constructor.
+     */
+    cow_array &operator=(const cow_array<content_type, allocator_type> &_other);
+
+    /**
+     * @brief Move assignment operator, which leaves the other array empty.
+     */
+    cow_array &operator=(cow_array<content_type, allocator_type> &&_other);
+};
+
+#include "cow_array.tpp"
+
+#endif // COW_ARRAY_HPP_
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <utility>
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type>::cow_array(const std::size_t &_size, const allocator_type &_allocator)
+    : m_allocator{_allocator},
+      m_buffer{create_buffer(array_type{_size, _allocator})}
+{
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type>::cow_array(array_type &&_values)
+    : m_allocator{_values.get_allocator()},
+      m_buffer{create_buffer(std::move(_values))}
+{
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type>::cow_array(const cow_array<content_type, allocator_type> &_other)
+    : m_allocator{_other.m_allocator},
+      m_buffer{_other.m_buffer}
+{
+    if (!m_buffer) {
+        return;
+    }
+
+    if (m_buffer->shareable) {
+        m_buffer->references.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // The other array might still be changed through a reference.
+        m_buffer = create_buffer(array_type{std::as_const(_other.m_buffer->values)});
+    }
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type>::cow_array(cow_array<content_type, allocator_type> &&_other)
+    : m_allocator{_other.m_allocator},
+      m_buffer{std::exchange(_other.m_buffer, nullptr)}
+{
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type>::~cow_array()
+{
+    release();
+}
+
+template <typename _content_type, typename _allocator_type>
+std::size_t cow_array<_content_type, _allocator_type>::size() const
+{
+    return m_buffer ? m_buffer->values.size() : 0;
+}
+
+template <typename _content_type, typename _allocator_type>
+std::size_t cow_array<_content_type, _allocator_type>::use_count() const
+{
+    return m_buffer ? m_buffer->references.load(std::memory_order_relaxed) : 0;
+}
+
+template <typename _content_type, typename _allocator_type>
+const _content_type *cow_array<_content_type, _allocator_type>::data() const
+{
+    return m_buffer ? std::as_const(m_buffer->values).data() : nullptr;
+}
+
+template <typename _content_type, typename _allocator_type>
+_content_type *cow_array<_content_type, _allocator_type>::data()
+{
+    detach_unshareable();
+
+    return m_buffer->values.data();
+}
+
+template <typename _content_type, typename _allocator_type>
+void cow_array<_content_type, _allocator_type>::resize(const std::size_t &_size)
+{
+    detach();
+
+    m_buffer->values.resize(_size);
+}
+
+template <typename _content_type, typename _allocator_type>
+typename cow_array<_content_type, _allocator_type>::shared_buffer *cow_array<_content_type, _allocator_type>::create_buffer(array_type &&_values)
+{
+    shared_buffer *const ret{buffer_allocator_traits::allocate(m_allocator, 1)};
+
+    try {
+        buffer_allocator_traits::construct(m_allocator, ret, std::size_t{1}, true, std::move(_values));
+    } catch (...) {
+        buffer_allocator_traits::deallocate(m_allocator, ret, 1);
+        throw;
+    }
+
+    return ret;
+}
+
+template <typename _content_type, typename _allocator_type>
+void cow_array<_content_type, _allocator_type>::release()
+{
+    // The last array frees the buffer after all other arrays stopped using it.
+    if (m_buffer && m_buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        buffer_allocator_traits::destroy(m_allocator, m_buffer);
+        buffer_allocator_traits::deallocate(m_allocator, m_buffer, 1);
+    }
+
+    m_buffer = nullptr;
+}
+
+template <typename _content_type, typename _allocator_type>
+void cow_array<_content_type, _allocator_type>::detach()
+{
+    if (!m_buffer) {
+        m_buffer = create_buffer(array_type{0, allocator_type{m_allocator}});
+    } else if (m_buffer->references.load(std::memory_order_acquire) != 1) {
+        shared_buffer *const buffer{create_buffer(array_type{std::as_const(m_buffer->values)})};
+
+        release();
+        m_buffer = buffer;
+    }
+}
+
+template <typename _content_type, typename _allocator_type>
+void cow_array<_content_type, _allocator_type>::detach_unshareable()
+{
+    detach();
+
+    m_buffer->shareable = false;
+}
+
+template <typename _content_type, typename _allocator_type>
+const _content_type &cow_array<_content_type, _allocator_type>::operator[](const std::size_t &_index) const
+{
+    return std::as_const(m_buffer->values)[_index];
+}
+
+template <typename _content_type, typename _allocator_type>
+_content_type &cow_array<_content_type, _allocator_type>::operator[](const std::size_t &_index)
+{
+    detach_unshareable();
+
+    return m_buffer->values[_index];
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type> &cow_array<_content_type, _allocator_type>::operator=(const cow_array<content_type, allocator_type> &_other)
+{
+    // The copy is made first, so self-assignment keeps the buffer and the
+    // array stays unchanged if copying the values throws.
+    if (this != &_other) {
+        *this = cow_array<content_type, allocator_type>{_other};
+    }
+
+    return *this;
+}
+
+template <typename _content_type, typename _allocator_type>
+cow_array<_content_type, _allocator_type> &cow_array<_content_type, _allocator_type>::operator=(cow_array<content_type, allocator_type> &&_other)
+{
+    if (this != &_other) {
+        release();
+        m_allocator = _other.m_allocator;
+        m_buffer    = std::exchange(_other.m_buffer, nullptr);
+    }
+
+    return *this;
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <utility>
+
+#include "cow_array.hpp"
+
+template <typename _content_type, typename _allocator_type>
+void print_array(const cow_array<_content_type, _allocator_type> &_arr)
+{
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        std::cout << ' ' << _arr[i];
+    }
+
+    std::cout << " ] : shared by " << _arr.use_count() << '\n';
+}
+
+/**
+ * @brief A pipeline stage, which only reads the values it gets by value.
+ */
+int sum(const cow_array<int> _arr)
+{
+    int ret{0};
+    for (std::size_t i{0}; i < _arr.size(); ++i) {
+        ret += _arr[i];
+    }
+
+    return ret;
+}
+
+int main()
+{
+    array<int> int_arr{11};
+    for (std::size_t i{0}; i < int_arr.size(); ++i) {
+        int_arr[i] = static_cast<int>(i) - 5;
+    }
+
+    // The values are taken over and then shared by all copies.
+    cow_array<int> original{std::move(int_arr)};
+    cow_array<int> copy{original};
+    cow_array<int> other_copy{0};
+    other_copy = copy;
+
+    print_array(original);
+    std::cout << "Sum: " << sum(original) << ", values shared: " << (std::as_const(copy).data() == std::as_const(original).data()) << '\n';
+
+    // Reading through a constant reference keeps the values shared, the
+    // first change copies them.
+    std::cout << "Read: " << std::as_const(copy)[0] << ", still shared by " << copy.use_count() << '\n';
+    copy[0] = 100;
+    copy.resize(12);
+    copy[11] = 200;
+
+    print_array(original);
+    print_array(copy);
+    print_array(other_copy);
+
+    // Changing an array, which is not shared, does not copy anything.
+    const int *const data{std::as_const(copy).data()};
+    copy[1] = 101;
+    std::cout << "Unshared change copied: " << (data != std::as_const(copy).data()) << '\n';
+
+    // Changes through a reference handed out earlier do not show up in later
+    // copies, as those copy the values.
+    int           &value{copy[0]};
+    cow_array<int> later_copy{copy};
+    value = 42;
+
+    print_array(copy);
+    print_array(later_copy);
+
+    return later_copy[0] == 100 ? 0 : 1;
+}
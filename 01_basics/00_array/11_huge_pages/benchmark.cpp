@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "array.hpp"
+#include "huge_page_resource.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Counts data TLB misses of the calling thread, if the kernel allows
+ *        it.
+ */
+class tlb_miss_counter {
+  private: // Member variables
+    int m_file;
+
+  public: // Constructors and destructor
+    tlb_miss_counter()
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+
+        attributes.type           = PERF_TYPE_HW_CACHE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attributes.disabled       = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+
+        m_file = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    tlb_miss_counter(const tlb_miss_counter &) = delete;
+
+    ~tlb_miss_counter()
+    {
+        if (m_file >= 0) {
+            close(m_file);
+        }
+    }
+
+  public: // Getter
+    bool available() const
+    {
+        return m_file >= 0;
+    }
+
+  public: // Functionality
+    void start()
+    {
+        if (available()) {
+            ioctl(m_file, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_file, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    std::uint64_t stop()
+    {
+        std::uint64_t ret{0};
+
+        if (available()) {
+            ioctl(m_file, PERF_EVENT_IOC_DISABLE, 0);
+
+            if (read(m_file, &ret, sizeof(ret)) != sizeof(ret)) {
+                ret = 0;
+            }
+        }
+
+        return ret;
+    }
+
+  public: // Operators
+    tlb_miss_counter &operator=(const tlb_miss_counter &) = delete;
+};
+
+/**
+ * @brief Reads values at random indices.
+ *
+ * @param _values The values.
+ * @param _bits Bool values tested at the same indices.
+ * @param _count The amount of reads.
+ * @param _counter The TLB miss counter.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @param _misses Receives the TLB misses per read.
+ * @return The time per read in ns.
+ */
+template <typename _values_type, typename _bits_type>
+double gather(const _values_type &_values, const _bits_type &_bits, const std::size_t &_count, tlb_miss_counter &_counter, std::uint64_t &_sum, double &_misses)
+{
+    std::uint64_t state{42};
+
+    _counter.start();
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::size_t i{0}; i < _count; ++i) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+
+        const std::size_t index{static_cast<std::size_t>((state >> 32) * _values.size() >> 32)};
+        _sum += _values[index] + (_bits[index] ? 1 : 0);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+    _misses = static_cast<double>(_counter.stop()) / static_cast<double>(_count);
+
+    return elapsed.count() / static_cast<double>(_count);
+}
+
+/**
+ * @brief Measures random reads of arrays from a given kind of pages.
+ */
+void benchmark_mode(const char *_name, const huge_page_mode &_mode, const std::size_t &_size, const std::size_t &_count, tlb_miss_counter &_counter, std::uint64_t &_sum)
+{
+    huge_page_resource resource{_mode};
+
+    array<std::uint64_t, huge_page_allocator<std::uint64_t>> values{_size, resource};
+    array<bool, huge_page_allocator<bool>>                   bits{_size, resource};
+    for (std::size_t i{0}; i < _size; ++i) {
+        values[i] = i;
+    }
+    bits.flip();
+
+    double       misses{0};
+    const double time{gather(values, bits, _count, _counter, _sum, misses)};
+
+    const huge_page_stats stats{resource.stats()};
+    std::cout << _name << " | " << resource.page_size(values.data()) << " | " << stats.explicit_bytes + stats.transparent_backed_bytes << " | " << time << " | ";
+    if (_counter.available()) {
+        std::cout << misses << '\n';
+    } else {
+        std::cout << "n/a\n";
+    }
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of values, the second one the
+ * amount of random reads.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t size{std::size_t{1} << 27};
+    if (_argc > 1) {
+        size = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::size_t count{std::size_t{1} << 24};
+    if (_argc > 2) {
+        count = std::strtoull(_argv[2], nullptr, 10);
+    }
+
+    tlb_miss_counter counter{};
+
+    std::cout << size * sizeof(std::uint64_t) / (1 << 20) << " MiB of values\npages | page size | huge page bytes | ns per read | dTLB misses per read\n";
+
+    std::uint64_t sum{0};
+    benchmark_mode("normal", huge_page_mode::normal_pages, size, count, counter, sum);
+    benchmark_mode("transparent", huge_page_mode::transparent_huge_pages, size, count, counter, sum);
+    benchmark_mode("explicit", huge_page_mode::explicit_huge_pages, size, count, counter, sum);
+
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "huge_page_resource.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <iterator>
+#include <system_error>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+huge_page_resource::huge_page_resource(const huge_page_mode &_mode, const std::size_t &_min_size)
+    : m_mode{_mode},
+      m_min_size{_min_size},
+      m_mappings{},
+      m_small_bytes{0}
+{
+}
+
+huge_page_resource::~huge_page_resource()
+{
+    for (const auto &[pointer, current] : m_mappings) {
+        munmap(pointer, current.size);
+    }
+}
+
+huge_page_stats huge_page_resource::stats() const
+{
+    huge_page_stats ret{0, 0, backed_bytes(nullptr), m_small_bytes};
+
+    for (const auto &current : m_mappings) {
+        switch (current.second.mode) {
+        case huge_page_mode::explicit_huge_pages:
+            ret.explicit_bytes += current.second.size;
+            break;
+        case huge_page_mode::transparent_huge_pages:
+            ret.transparent_bytes += current.second.size;
+            break;
+        case huge_page_mode::normal_pages:
+            ret.normal_bytes += current.second.size;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+std::size_t huge_page_resource::page_size(const void *_pointer) const
+{
+    const auto found{m_mappings.find(const_cast<void *>(_pointer))};
+
+    if (found != m_mappings.end()) {
+        if (found->second.mode == huge_page_mode::explicit_huge_pages) {
+            return huge_page_size;
+        }
+
+        // A kernel mapping shared with an adjacent allocation might contain
+        // its huge pages, too.
+        if (found->second.mode == huge_page_mode::transparent_huge_pages && 2 * std::min(backed_bytes(_pointer), found->second.size) >= found->second.size) {
+            return huge_page_size;
+        }
+    }
+
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+void *huge_page_resource::allocate(const std::size_t &_size, const std::size_t &_alignment)
+{
+    if (_size < m_min_size || _alignment > huge_page_size) {
+        void *const ret{::operator new(_size, std::align_val_t{_alignment})};
+        m_small_bytes += _size;
+
+        return ret;
+    }
+
+    const std::size_t size{(_size + huge_page_size - 1) / huge_page_size * huge_page_size};
+    huge_page_mode    mode{m_mode};
+    void *const       ret{map(size, mode)};
+
+    try {
+        m_mappings.emplace(ret, mapping{size, mode});
+    } catch (...) {
+        munmap(ret, size);
+        throw;
+    }
+
+    return ret;
+}
+
+void huge_page_resource::deallocate(void *_pointer, const std::size_t &_size, const std::size_t &_alignment)
+{
+    const auto found{m_mappings.find(_pointer)};
+
+    if (found == m_mappings.end()) {
+        ::operator delete(_pointer, _size, std::align_val_t{_alignment});
+        m_small_bytes -= _size;
+
+        return;
+    }
+
+    munmap(_pointer, found->second.size);
+    m_mappings.erase(found);
+}
+
+void *huge_page_resource::map(const std::size_t &_size, huge_page_mode &_mode)
+{
+    if (_mode == huge_page_mode::explicit_huge_pages) {
+        int flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB};
+#ifdef MAP_HUGE_SHIFT
+        flags |= 21 << MAP_HUGE_SHIFT;
+#endif
+
+        void *const ret{mmap(nullptr, _size, PROT_READ | PROT_WRITE, flags, -1, 0)};
+        if (ret != MAP_FAILED) {
+            return ret;
+        }
+
+        // No reserved huge pages are available.
+        _mode = huge_page_mode::transparent_huge_pages;
+    }
+
+    // Map an additional huge page and unmap the unaligned head and tail, so
+    // the whole memory can be backed by huge pages.
+    void *const mapping{mmap(nullptr, _size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (mapping == MAP_FAILED) {
+        throw_system_error("mmap");
+    }
+
+    unsigned char *const begin{static_cast<unsigned char *>(mapping)};
+    unsigned char *const ret{begin + (huge_page_size - reinterpret_cast<std::uintptr_t>(begin) % huge_page_size) % huge_page_size};
+    unsigned char *const end{begin + _size + huge_page_size};
+
+    if (ret != begin) {
+        munmap(begin, static_cast<std::size_t>(ret - begin));
+    }
+    if (ret + _size != end) {
+        munmap(ret + _size, static_cast<std::size_t>(end - (ret + _size)));
+    }
+
+    if (_mode == huge_page_mode::transparent_huge_pages && madvise(ret, _size, MADV_HUGEPAGE) != 0) {
+        // Transparent huge pages are disabled or not supported.
+        _mode = huge_page_mode::normal_pages;
+    } else if (_mode == huge_page_mode::normal_pages) {
+        madvise(ret, _size, MADV_NOHUGEPAGE);
+    }
+
+    return ret;
+}
+
+std::size_t huge_page_resource::backed_bytes(const void *_pointer) const
+{
+    std::FILE *const file{std::fopen("/proc/self/smaps", "r")};
+    if (!file) {
+        return 0;
+    }
+
+    // Every kernel mapping starts with its address range followed by its
+    // details. Adjacent allocations might share a kernel mapping, so each one
+    // is only counted once.
+    std::size_t ret{0};
+    bool        selected{false};
+    char        line[256];
+
+    while (std::fgets(line, sizeof(line), file)) {
+        unsigned long long first{0};
+        unsigned long long last{0};
+        unsigned long long kilobytes{0};
+
+        if (std::sscanf(line, "%llx-%llx ", &first, &last) == 2) {
+            // Checks whether the kernel mapping contains transparent huge pages
+            // of an allocation.
+            const auto overlaps{[&first, &last](const std::pair<void *const, mapping> &_current) {
+                const unsigned long long begin{reinterpret_cast<std::uintptr_t>(_current.first)};
+
+                return _current.second.mode == huge_page_mode::transparent_huge_pages && begin < last && first < begin + _current.second.size;
+            }};
+
+            if (_pointer) {
+                selected = overlaps(*m_mappings.find(const_cast<void *>(_pointer)));
+            } else {
+                const auto current{m_mappings.lower_bound(reinterpret_cast<void *>(first))};
+
+                selected = (current != m_mappings.end() && overlaps(*current)) || (current != m_mappings.begin() && overlaps(*std::prev(current)));
+            }
+        } else if (selected && std::sscanf(line, "AnonHugePages: %llu kB", &kilobytes) == 1) {
+            ret += static_cast<std::size_t>(kilobytes) * 1024;
+        }
+    }
+
+    std::fclose(file);
+
+    return ret;
+}
+
+void huge_page_resource::throw_system_error(const char *_what)
+{
+    throw std::system_error{errno, std::generic_category(), _what};
+}
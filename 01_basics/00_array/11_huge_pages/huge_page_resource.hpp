@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef HUGE_PAGE_RESOURCE_HPP_
+#define HUGE_PAGE_RESOURCE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <new>
+
+/**
+ * @brief The pages a memory resource requests for large allocations.
+ */
+enum class huge_page_mode {
+    /**
+     * @brief Reserved huge pages (MAP_HUGETLB), falling back to transparent
+     *        huge pages if none are available.
+     */
+    explicit_huge_pages,
+
+    /**
+     * @brief Memory advised to be backed by transparent huge pages
+     *        (MADV_HUGEPAGE), falling back to normal pages.
+     */
+    transparent_huge_pages,
+
+    /**
+     * @brief Normal pages only (MADV_NOHUGEPAGE), e.g. for comparisons.
+     */
+    normal_pages
+};
+
+/**
+ * @brief The amount of bytes currently allocated per kind of pages.
+ */
+struct huge_page_stats {
+    /**
+     * @brief Bytes mapped with reserved huge pages.
+     */
+    std::size_t explicit_bytes;
+
+    /**
+     * @brief Bytes advised to be backed by transparent huge pages.
+     */
+    std::size_t transparent_bytes;
+
+    /**
+     * @brief Bytes of the advised memory the kernel actually backs with
+     *        transparent huge pages, which only counts touched memory.
+     */
+    std::size_t transparent_backed_bytes;
+
+    /**
+     * @brief Bytes mapped with normal pages, including small allocations.
+     */
+    std::size_t normal_bytes;
+};
+
+/**
+ * @brief A memory resource mapping large allocations with 2 MiB pages.
+ *
+ * Every large allocation is mapped on its own and aligned to the huge page
+ * size, so randomly accessing gigabytes of memory needs far fewer TLB entries.
+ * Reserved huge pages are tried first, then transparent huge pages, which the
+ * kernel may or may not provide. Small allocations are taken from the global
+ * allocation function, as they would waste most of a huge page.
+ *
+ * This class relies on Linux specific system calls and files.
+ */
+class huge_page_resource {
+  private: // Classes
+    /**
+     * @brief A large allocation.
+     */
+    struct mapping {
+        /**
+         * @brief The mapped size, which is a multiple of the huge page size.
+         */
+        std::size_t size;
+
+        /**
+         * @brief The pages actually requested.
+         */
+        huge_page_mode mode;
+    };
+
+  public: // Static members
+    /**
+     * @brief The size of a huge page.
+     */
+    static const constexpr std::size_t huge_page_size{std::size_t{2} << 20};
+
+  private: // Member variables
+    /**
+     * @brief The preferred pages.
+     */
+    huge_page_mode m_mode;
+
+    /**
+     * @brief The smallest allocation that is mapped with huge pages.
+     */
+    std::size_t m_min_size;
+
+    /**
+     * @brief All large allocations by their address.
+     */
+    std::map<void *, mapping> m_mappings;
+
+    /**
+     * @brief The bytes of all small allocations.
+     */
+    std::size_t m_small_bytes;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates a resource without any allocations.
+     *
+     * @param _mode The preferred pages.
+     * @param _min_size The smallest allocation that is mapped with huge
+     *                  pages.
+     */
+    explicit huge_page_resource(const huge_page_mode &_mode = huge_page_mode::explicit_huge_pages, const std::size_t &_min_size = huge_page_size / 2);
+
+    /**
+     * @brief The allocated memory is owned by the resource, so it can not be
+     *        copied.
+     */
+    huge_page_resource(const huge_page_resource &_other) = delete;
+
+    /**
+     * @brief Unmaps all remaining large allocations.
+     */
+    ~huge_page_resource();
+
+  public: // Getter
+    /**
+     * @brief Returns the amount of bytes currently allocated per kind of
+     *        pages.
+     *
+     * @return The statistics.
+     */
+    huge_page_stats stats() const;
+
+    /**
+     * @brief Returns the size of the pages backing an allocation.
+     *
+     * Transparent huge pages are only reported once the memory has been
+     * touched and the kernel backed at least half of it with huge pages.
+     *
+     * @param _pointer The allocated memory.
+     * @return The page size in bytes.
+     */
+    std::size_t page_size(const void *_pointer) const;
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory.
+     *
+     * @param _size The size of the memory in bytes.
+     * @param _alignment The alignment of the memory, which is a power of two.
+     * @return Pointer to the allocated memory.
+     * @throws std::system_error if the memory could not be mapped.
+     */
+    void *allocate(const std::size_t &_size, const std::size_t &_alignment);
+
+    /**
+     * @brief Frees memory.
+     *
+     * @param _pointer The allocated memory.
+     * @param _size The size given to allocate().
+     * @param _alignment The alignment given to allocate().
+     */
+    void deallocate(void *_pointer, const std::size_t &_size, const std::size_t &_alignment);
+
+  private: // Functionality
+    /**
+     * @brief Returns the bytes backed by transparent huge pages according to
+     *        /proc/self/smaps.
+     *
+     * @param _pointer An allocation or nullptr for all allocations.
+     * @return The amount of bytes.
+     */
+    std::size_t backed_bytes(const void *_pointer) const;
+
+  private: // Static functionality
+    /**
+     * @brief Maps memory aligned to the huge page size.
+     *
+     * @param _size The size of the memory, which is a multiple of the huge
+     *              page size.
+     * @param _mode The preferred pages, which receives the pages actually
+     *              requested.
+     * @return Pointer to the mapped memory.
+     */
+    static void *map(const std::size_t &_size, huge_page_mode &_mode);
+
+
+    /**
+     * @brief Throws a system error for the current errno value.
+     *
+     * @param _what The failed operation.
+     */
+    [[noreturn]] static void throw_system_error(const char *_what);
+
+  public: // Operators
+    /**
+     * @brief The allocated memory is owned by the resource, so it can not be
+     *        assigned.
+     */
+    huge_page_resource &operator=(const huge_page_resource &_other) = delete;
+};
+
+/**
+ * @brief Allocator taking its memory from a huge page resource.
+ *
+ * All copies refer to the same resource, which has to outlive every container
+ * using the allocator.
+ */
+template <typename _content_type>
+class huge_page_allocator {
+  public: // Typedefs
+    /**
+     * @brief The type of the allocated values.
+     */
+    typedef _content_type value_type;
+
+  private: // Member variables
+    /**
+     * @brief The resource the memory is taken from.
+     */
+    huge_page_resource *m_resource;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates an allocator taking its memory from the given resource.
+     *
+     * @param _resource The resource the memory is taken from.
+     */
+    huge_page_allocator(huge_page_resource &_resource)
+        : m_resource{&_resource}
+    {
+    }
+
+    /**
+     * @brief Rebinding constructor.
+     */
+    template <typename _other_content_type>
+    huge_page_allocator(const huge_page_allocator<_other_content_type> &_other)
+        : m_resource{&_other.resource()}
+    {
+    }
+
+  public: // Getter
+    /**
+     * @brief Returns the resource the memory is taken from.
+     */
+    huge_page_resource &resource() const
+    {
+        return *m_resource;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Allocates memory for the given amount of values.
+     */
+    value_type *allocate(const std::size_t &_count)
+    {
+        if (_count > SIZE_MAX / sizeof(value_type)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<value_type *>(m_resource->allocate(_count * sizeof(value_type), alignof(value_type)));
+    }
+
+    /**
+     * @brief Frees memory of the given amount of values.
+     */
+    void deallocate(value_type *_pointer, const std::size_t &_count)
+    {
+        m_resource->deallocate(_pointer, _count * sizeof(value_type), alignof(value_type));
+    }
+
+  public: // Operators
+    /**
+     * @brief Allocators are equal if they use the same resource.
+     */
+    template <typename _other_content_type>
+    bool operator==(const huge_page_allocator<_other_content_type> &_other) const
+    {
+        return m_resource == &_other.resource();
+    }
+
+    /**
+     * @brief Allocators are unequal if they use different resources.
+     */
+    template <typename _other_content_type>
+    bool operator!=(const huge_page_allocator<_other_content_type> &_other) const
+    {
+        return !(*this == _other);
+    }
+};
+
+#endif // HUGE_PAGE_RESOURCE_HPP_
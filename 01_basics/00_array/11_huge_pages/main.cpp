@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+
+#include "array.hpp"
+#include "huge_page_resource.hpp"
+
+void print_stats(const char *_name, const huge_page_resource &_resource)
+{
+    const huge_page_stats stats{_resource.stats()};
+
+    std::cout << _name << ": explicit " << stats.explicit_bytes << " bytes, transparent " << stats.transparent_bytes << " bytes ("
+              << stats.transparent_backed_bytes << " backed), normal " << stats.normal_bytes << " bytes\n";
+}
+
+int main()
+{
+    for (const huge_page_mode &mode : {huge_page_mode::explicit_huge_pages, huge_page_mode::transparent_huge_pages, huge_page_mode::normal_pages}) {
+        huge_page_resource resource{mode};
+
+        // Large arrays are mapped on their own, small ones are not.
+        array<double, huge_page_allocator<double>> double_arr{std::size_t{1} << 20, resource};
+        array<bool, huge_page_allocator<bool>>     bool_arr{std::size_t{1} << 25, resource};
+        array<int, huge_page_allocator<int>>       int_arr{100, resource};
+
+        // The pages are only backed once they are touched.
+        for (std::size_t i{0}; i < double_arr.size(); ++i) {
+            double_arr[i] = static_cast<double>(i);
+        }
+        bool_arr.flip();
+
+        std::cout << "Page sizes: " << resource.page_size(double_arr.data()) << ", " << resource.page_size(bool_arr.words()) << ", "
+                  << resource.page_size(int_arr.data()) << '\n';
+        print_stats(mode == huge_page_mode::explicit_huge_pages ? "Explicit" : (mode == huge_page_mode::transparent_huge_pages ? "Transparent" : "Normal"), resource);
+
+        // Freed arrays are unmapped at once.
+        double_arr.resize(0);
+        double_arr.shrink_to_fit();
+        print_stats("Shrunk", resource);
+    }
+
+    return 0;
+}
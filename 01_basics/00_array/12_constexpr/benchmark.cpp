@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "frozen_array.hpp"
+#include "lookup_tables.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The amount of numbers checked by the prime sieve.
+ */
+static const constexpr std::size_t s_prime_limit{65536};
+
+/**
+ * @brief The CRC-32 table built during compilation.
+ */
+static constexpr auto s_crc32_table{freeze<make_crc32_table>()};
+
+/**
+ * @brief The prime sieve built during compilation.
+ */
+static constexpr auto s_primes{freeze<[] { return make_prime_sieve(s_prime_limit); }>()};
+
+/**
+ * @brief Measures the time needed to build the tables at runtime, as done at
+ *        startup without frozen tables.
+ *
+ * @param _count The amount of builds.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @return The time per build of both tables in us.
+ */
+double benchmark_build(const std::size_t &_count, std::uint64_t &_sum)
+{
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::size_t i{0}; i < _count; ++i) {
+        const array<std::uint32_t> crc32_table{make_crc32_table()};
+        const array<bool>          primes{make_prime_sieve(s_prime_limit)};
+
+        _sum += crc32_table[i % crc32_table.size()] + primes.count();
+    }
+
+    const std::chrono::duration<double, std::micro> elapsed{benchmark_clock::now() - start};
+
+    return elapsed.count() / static_cast<double>(_count);
+}
+
+/**
+ * @brief Measures the lookups into a table.
+ *
+ * Computes the CRC-32 of a buffer and counts the primes at pseudo-random
+ * positions.
+ *
+ * @param _crc32_table The CRC-32 table.
+ * @param _primes The prime sieve.
+ * @param _buffer The buffer.
+ * @param _size The size of the buffer, which is also the amount of prime
+ *              lookups.
+ * @param _sum Receives a checksum, which keeps the work from being optimized
+ *             away.
+ * @return The time per byte in ns.
+ */
+template <typename _crc32_table_type, typename _primes_type>
+double benchmark_lookup(const _crc32_table_type &_crc32_table, const _primes_type &_primes, const unsigned char *_buffer, const std::size_t &_size, std::uint64_t &_sum)
+{
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    _sum += crc32(_crc32_table, _buffer, _size);
+
+    std::uint64_t state{_sum};
+    for (std::size_t i{0}; i < _size; ++i) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        _sum += _primes[(state >> 32) % s_prime_limit] ? 1 : 0;
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    return elapsed.count() / static_cast<double>(_size);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of table builds, the buffer has
+ * 4096 bytes per build.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::size_t count{200};
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    std::uint64_t sum{0};
+
+    std::cout << "Build at runtime: " << benchmark_build(count, sum) << " us, frozen: 0 us (" << sizeof(s_crc32_table) + sizeof(s_primes) << " bytes of read-only data)\n";
+
+    array<unsigned char> buffer{count * 4096};
+    std::uint64_t        state{1};
+    for (std::size_t i{0}; i < buffer.size(); ++i) {
+        state     = state * 6364136223846793005u + 1442695040888963407u;
+        buffer[i] = static_cast<unsigned char>(state >> 56);
+    }
+
+    const array<std::uint32_t> crc32_table{make_crc32_table()};
+    const array<bool>          primes{make_prime_sieve(s_prime_limit)};
+
+    const double runtime_lookup{benchmark_lookup(crc32_table, primes, buffer.data(), buffer.size(), sum)};
+    const double frozen_lookup{benchmark_lookup(s_crc32_table, s_primes, buffer.data(), buffer.size(), sum)};
+
+    std::cout << "Lookup runtime tables: " << runtime_lookup << " ns/byte, frozen tables: " << frozen_lookup << " ns/byte\n";
+    std::cout << "checksum " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef FROZEN_ARRAY_HPP_
+#define FROZEN_ARRAY_HPP_
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "array.hpp"
+
+/**
+ * @brief A fixed size copy of a bool array, which was built during constant
+ *        evaluation.
+ *
+ * The values are packed into words the same way as in array<bool>, so a
+ * constexpr variable of this class is saved as a table of words in the
+ * read-only data of the binary.
+ */
+template <std::size_t _size>
+class frozen_bool_array {
+  public: // Typedefs
+    /**
+     * @brief The type of the words the values are packed into.
+     */
+    typedef std::uint64_t word_type;
+
+  private: // Static members
+    static const constexpr std::size_t s_word_bit_size{CHAR_BIT * sizeof(word_type)};
+
+  public: // Static members
+    /**
+     * @brief The amount of words the values are packed into.
+     */
+    static const constexpr std::size_t word_count{(_size + s_word_bit_size - 1) / s_word_bit_size};
+
+  private: // Member variables
+    /**
+     * @brief The words the values are packed into.
+     *
+     * Value i is bit i % 64 of word i / 64.
+     */
+    std::array<word_type, word_count> m_words;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Creates a frozen array from the words of a bool array.
+     *
+     * @param _words The words the values are packed into.
+     */
+    explicit constexpr frozen_bool_array(const std::array<word_type, word_count> &_words);
+
+  public: // Getter
+    /**
+     * @brief Returns the size of the array.
+     *
+     * @return The array size.
+     */
+    constexpr std::size_t size() const;
+
+    /**
+     * @brief Returns the words the values are packed into.
+     *
+     * @return Reference to the words.
+     */
+    constexpr const std::array<word_type, word_count> &words() const;
+
+    /**
+     * @brief Returns the amount of true values.
+     *
+     * @return The population count of the whole array.
+     */
+    constexpr std::size_t count() const;
+
+  public: // Operators
+    /**
+     * @brief Returns the value at a given index.
+     *
+     * The access is unchecked. Beware of undefined behaviour if the index is
+     * not within the array bounds (0 <= index < size()).
+     *
+     * @param _index The index that should be accessed.
+     * @return The value at the given index.
+     */
+    constexpr bool operator[](const std::size_t &_index) const;
+};
+
+/**
+ * @brief Copies an array built during constant evaluation into a fixed size
+ *        table.
+ *
+ * Memory allocated during constant evaluation has to be freed within the same
+ * evaluation, so an array can not be a constexpr variable itself. The
+ * generator is called once for the size and once for the values, which are
+ * copied into a std::array or, for bool arrays, into a frozen_bool_array.
+ * Assigning the result to a constexpr variable bakes the table into the
+ * binary instead of building it at startup:
+ *
+ *     static constexpr auto table{freeze<make_table>()};
+ *
+ * The array has to use std::allocator, as other allocators can not allocate
+ * during constant evaluation, and its values have to be default
+ * constructible.
+ *
+ * @tparam _generator A constexpr function or lambda without parameters
+ *                    returning the array.
+ * @return The fixed size copy of the array.
+ */
+template <auto _generator>
+consteval auto freeze();
+
+#include "frozen_array.tpp"
+
+#endif // FROZEN_ARRAY_HPP_
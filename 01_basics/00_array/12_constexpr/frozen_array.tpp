@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <bit>
+
+template <std::size_t _size>
+constexpr frozen_bool_array<_size>::frozen_bool_array(const std::array<word_type, word_count> &_words)
+    : m_words{_words}
+{
+}
+
+template <std::size_t _size>
+constexpr std::size_t frozen_bool_array<_size>::size() const
+{
+    return _size;
+}
+
+template <std::size_t _size>
+constexpr const std::array<typename frozen_bool_array<_size>::word_type, frozen_bool_array<_size>::word_count> &frozen_bool_array<_size>::words() const
+{
+    return m_words;
+}
+
+template <std::size_t _size>
+constexpr std::size_t frozen_bool_array<_size>::count() const
+{
+    std::size_t ret{0};
+    for (const word_type &word : m_words) {
+        ret += static_cast<std::size_t>(std::popcount(word));
+    }
+
+    return ret;
+}
+
+template <std::size_t _size>
+constexpr bool frozen_bool_array<_size>::operator[](const std::size_t &_index) const
+{
+    return ((m_words[_index / s_word_bit_size] >> (_index % s_word_bit_size)) & 1) != 0;
+}
+
+template <auto _generator>
+consteval auto freeze()
+{
+    typedef std::remove_cvref_t<decltype(_generator())> array_type;
+    typedef typename array_type::content_type           content_type;
+
+    // The size is a constant expression of its own, as it is part of the
+    // returned type.
+    constexpr std::size_t size{_generator().size()};
+
+    const array_type arr{_generator()};
+
+    if constexpr (std::is_same_v<content_type, bool>) {
+        std::array<typename frozen_bool_array<size>::word_type, frozen_bool_array<size>::word_count> words{};
+        std::copy_n(arr.words(), arr.word_count(), words.begin());
+
+        return frozen_bool_array<size>{words};
+    } else {
+        std::array<content_type, size> ret{};
+        std::copy_n(arr.data(), size, ret.begin());
+
+        return ret;
+    }
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef LOOKUP_TABLES_HPP_
+#define LOOKUP_TABLES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "array.hpp"
+
+/**
+ * @brief The reflected polynomial of CRC-32 as used by zlib and Ethernet.
+ */
+inline constexpr std::uint32_t crc32_polynomial{0xedb88320u};
+
+/**
+ * @brief Builds the table of the CRC-32 of every byte.
+ *
+ * Can be called at runtime or during constant evaluation.
+ *
+ * @return The 256 table entries.
+ */
+constexpr array<std::uint32_t> make_crc32_table()
+{
+    array<std::uint32_t> ret{256};
+
+    for (std::uint32_t i{0}; i < ret.size(); ++i) {
+        std::uint32_t value{i};
+        for (std::size_t bit{0}; bit < 8; ++bit) {
+            value = (value & 1) != 0 ? (value >> 1) ^ crc32_polynomial : value >> 1;
+        }
+
+        ret[i] = value;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Builds a sieve of Eratosthenes.
+ *
+ * Can be called at runtime or during constant evaluation.
+ *
+ * @param _limit The amount of numbers checked.
+ * @return Array whose value i is true if i is a prime number.
+ */
+constexpr array<bool> make_prime_sieve(const std::size_t &_limit)
+{
+    array<bool> ret{_limit};
+    ret.flip();
+
+    for (std::size_t i{0}; i < 2 && i < _limit; ++i) {
+        ret[i] = false;
+    }
+
+    for (std::size_t i{2}; i * i < _limit; ++i) {
+        if (ret[i]) {
+            for (std::size_t j{i * i}; j < _limit; j += i) {
+                ret[j] = false;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Computes the CRC-32 of a buffer a byte at a time.
+ *
+ * @param _table The table of the CRC-32 of every byte.
+ * @param _data The buffer.
+ * @param _size The size of the buffer.
+ * @return The checksum.
+ */
+template <typename _table_type>
+constexpr std::uint32_t crc32(const _table_type &_table, const unsigned char *_data, const std::size_t &_size)
+{
+    std::uint32_t ret{0xffffffffu};
+    for (std::size_t i{0}; i < _size; ++i) {
+        ret = (ret >> 8) ^ _table[(ret ^ _data[i]) & 0xffu];
+    }
+
+    return ret ^ 0xffffffffu;
+}
+
+#endif // LOOKUP_TABLES_HPP_
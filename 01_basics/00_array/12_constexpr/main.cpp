@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <utility>
+
+#include "frozen_array.hpp"
+#include "lookup_tables.hpp"
+
+/**
+ * @brief Exercises the array during constant evaluation.
+ *
+ * @return The sum of all values after appending, copying, moving and
+ *         evaluating an expression.
+ */
+constexpr int compile_time_sum()
+{
+    array<int> appended_arr{0};
+    for (int i{1}; i <= 20; ++i) {
+        appended_arr.push_back(i);
+    }
+    appended_arr.resize(10);
+    appended_arr.shrink_to_fit();
+
+    array<int> copied_arr{appended_arr};
+    array<int> moved_arr{std::move(copied_arr)};
+    moved_arr = appended_arr * appended_arr + 1;
+
+    int ret{0};
+    for (std::size_t i{0}; i < moved_arr.size(); ++i) {
+        ret += moved_arr[i];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Exercises the bool array during constant evaluation.
+ *
+ * @return The amount of true values after combining and resizing.
+ */
+constexpr std::size_t compile_time_count()
+{
+    array<bool> even_arr{200};
+    for (std::size_t i{0}; i < even_arr.size(); i += 2) {
+        even_arr[i] = true;
+    }
+
+    array<bool> odd_arr{~even_arr};
+    odd_arr ^= even_arr;
+    odd_arr.resize(100);
+    odd_arr.build_rank_index();
+
+    return odd_arr.count() + odd_arr.rank(50) + odd_arr.select(7) + even_arr.find_next(3);
+}
+
+static_assert(compile_time_sum() == 395);
+static_assert(compile_time_count() == 100 + 50 + 7 + 4);
+
+/**
+ * @brief The CRC-32 table, which is saved in the read-only data of the binary.
+ */
+static constexpr auto s_crc32_table{freeze<make_crc32_table>()};
+
+/**
+ * @brief The prime numbers below 65536, which are saved in the read-only data
+ *        of the binary.
+ */
+static constexpr auto s_primes{freeze<[] { return make_prime_sieve(65536); }>()};
+
+static_assert(s_crc32_table.size() == 256 && s_crc32_table[1] == 0x77073096u && s_crc32_table[255] == 0x2d02ef8du);
+static_assert(s_primes.size() == 65536 && s_primes.count() == 6542 && s_primes[65521] && !s_primes[65535]);
+
+int main()
+{
+    const unsigned char text[]{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    // The frozen tables match the tables built at runtime.
+    const array<std::uint32_t> crc32_table{make_crc32_table()};
+    const array<bool>          primes{make_prime_sieve(s_primes.size())};
+
+    bool equal{primes.count() == s_primes.count()};
+    for (std::size_t i{0}; i < s_crc32_table.size(); ++i) {
+        equal = equal && crc32_table[i] == s_crc32_table[i];
+    }
+    for (std::size_t i{0}; i < s_primes.words().size(); ++i) {
+        equal = equal && primes.words()[i] == s_primes.words()[i];
+    }
+
+    const std::uint32_t checksum{crc32(s_crc32_table, text, sizeof(text))};
+    equal = equal && checksum == 0xcbf43926u;
+
+    std::cout << std::hex << "CRC-32 of \"123456789\": " << checksum << std::dec << ", primes below " << s_primes.size() << ": "
+              << s_primes.count() << ", tables equal: " << equal << '\n';
+
+    return equal ? 0 : 1;
+}
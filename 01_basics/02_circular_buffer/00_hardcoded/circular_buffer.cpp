@@ -16,9 +16,9 @@ circular_buffer::circular_buffer()
 circular_buffer::circular_buffer(const circular_buffer &_other)
     : m_data{new int[s_capacity]},
       m_first_free{_other.m_first_free},
-      m_first_valid{_other.m_first_free}
+      m_first_valid{_other.m_first_valid}
 {
-    std::memcpy(m_data, _other.m_data, s_capacity);
+    std::copy_n(_other.m_data, s_capacity, m_data);
 }
 
 circular_buffer::circular_buffer(circular_buffer &&_other)
@@ -32,7 +32,7 @@ circular_buffer::circular_buffer(circular_buffer &&_other)
 circular_buffer::~circular_buffer()
 {
     if (m_data) {
-        delete m_data;
+        delete[] m_data;
     }
 }
 
@@ -76,23 +76,31 @@ int circular_buffer::pop()
 
 circular_buffer &circular_buffer::operator=(const circular_buffer &_other)
 {
+    if (this == &_other) {
+        return *this;
+    }
+
     if (m_data) {
-        delete m_data;
+        delete[] m_data;
     }
 
     m_data        = new int[s_capacity];
     m_first_free  = _other.m_first_free;
     m_first_valid = _other.m_first_valid;
 
-    std::memcpy(m_data, _other.m_data, s_capacity);
+    std::copy_n(_other.m_data, s_capacity, m_data);
 
     return *this;
 }
 
 circular_buffer &circular_buffer::operator=(circular_buffer &&_other)
 {
+    if (this == &_other) {
+        return *this;
+    }
+
     if (m_data) {
-        delete m_data;
+        delete[] m_data;
     }
 
     m_data        = std::move(_other.m_data);
@@ -58,9 +58,9 @@ class circular_buffer {
     circular_buffer(const circular_buffer<content_type> &_other)
         : m_data{new content_type[s_capacity]},
           m_first_free{_other.m_first_free},
-          m_first_valid{_other.m_first_free}
+          m_first_valid{_other.m_first_valid}
     {
-        std::memcpy(m_data, _other.m_data, s_capacity);
+        std::copy_n(_other.m_data, s_capacity, m_data);
     }
 
     /**
@@ -80,7 +80,7 @@ class circular_buffer {
     ~circular_buffer()
     {
         if (m_data) {
-            delete m_data;
+            delete[] m_data;
         }
     }
 
@@ -150,15 +150,19 @@ class circular_buffer {
      */
     circular_buffer &operator=(const circular_buffer<content_type> &_other)
     {
+        if (this == &_other) {
+            return *this;
+        }
+
         if (m_data) {
-            delete m_data;
+            delete[] m_data;
         }
 
         m_data        = new content_type[s_capacity];
         m_first_free  = _other.m_first_free;
         m_first_valid = _other.m_first_valid;
 
-        std::memcpy(m_data, _other.m_data, s_capacity);
+        std::copy_n(_other.m_data, s_capacity, m_data);
 
         return *this;
     }
@@ -168,8 +172,12 @@ class circular_buffer {
      */
     circular_buffer &operator=(circular_buffer<content_type> &&_other)
     {
+        if (this == &_other) {
+            return *this;
+        }
+
         if (m_data) {
-            delete m_data;
+            delete[] m_data;
         }
 
         m_data        = std::move(_other.m_data);
@@ -5,13 +5,57 @@
 #define CIRCULAR_BUFFER_HPP_
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Overflow policy, which overwrites the oldest value if a value is
+ *        pushed to a full buffer.
+ */
+struct overwrite_policy {
+};
+
+/**
+ * @brief Overflow policy, which rejects values pushed to a full buffer.
+ */
+struct reject_policy {
+};
+
+/**
+ * @brief Overflow policy, which blocks a producer pushing to a full buffer and
+ *        a consumer popping from an empty buffer.
+ *
+ * The buffer can be shared between one producer and one consumer thread. The
+ * producer uses push(), try_push(), push_n(), writable_segments() and
+ * commit_write(), the consumer uses pop(), try_pop(), pop_n(),
+ * readable_segments() and commit_read(). Each of them reads the index of the
+ * other thread only once, so a concurrent change can not tear its result.
+ */
+struct block_policy {
+};
 
 /**
  * @brief A templated class implementing a circular buffer.
+ *
+ * The values are stored inside the object itself, so the buffer does not
+ * allocate and can be used in constant expressions. Values are constructed
+ * when they are pushed and destroyed when they are popped, so the content
+ * type does not need to be default constructible.
+ *
+ * One slot is always kept free to distinguish a full from an empty buffer, so
+ * at most capacity - 1 values can be saved at the same time.
  */
-template <typename _content_type, std::size_t _capacity>
+template <typename _content_type, std::size_t _capacity, typename _overflow_policy = overwrite_policy>
 class circular_buffer {
   public: // Asserts
     /**
@@ -19,38 +63,249 @@ class circular_buffer {
      */
     static_assert(_capacity > 0, "The buffer capacity is required to be bigger than zero.");
 
+    /**
+     * @brief Verify that the overflow policy is known.
+     */
+    static_assert(std::is_same_v<_overflow_policy, overwrite_policy> || std::is_same_v<_overflow_policy, reject_policy> || std::is_same_v<_overflow_policy, block_policy>,
+                  "The overflow policy is required to be one of overwrite_policy, reject_policy or block_policy.");
+
   public: // Typedefs
     /**
      * @brief The content type of the buffer.
      */
     typedef _content_type content_type;
 
+    /**
+     * @brief A contiguous part of the buffer that can be written.
+     */
+    typedef std::span<content_type> writable_segment;
+
+    /**
+     * @brief A contiguous part of the buffer that can be read.
+     */
+    typedef std::span<const content_type> readable_segment;
+
+    /**
+     * @brief The overflow policy of the buffer.
+     */
+    typedef _overflow_policy overflow_policy;
+
   public: // Static member variables
     static const constexpr std::size_t capacity{_capacity};
 
+  private: // Static member variables
+    /**
+     * @brief Whether the buffer blocks and has to synchronize its indices.
+     */
+    static const constexpr bool s_blocking{std::is_same_v<overflow_policy, block_policy>};
+
+  private: // Typedefs
+    /**
+     * @brief The type of the indices.
+     *
+     * A blocking buffer is shared between threads and waits for changes of
+     * the indices, so they need to be atomic.
+     */
+    typedef std::conditional_t<s_blocking, std::atomic<std::size_t>, std::size_t> index_type;
+
+  public: // Classes
+    /**
+     * @brief Random access iterator over the saved values.
+     *
+     * Iterating does not modify the buffer, the values are visited from the
+     * oldest to the newest one. The iterators are invalidated by any
+     * modification of the buffer.
+     */
+    template <typename _value_type>
+    class basic_iterator {
+      public: // Typedefs
+        typedef std::random_access_iterator_tag iterator_concept;
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef std::remove_const_t<_value_type> value_type;
+        typedef std::ptrdiff_t                   difference_type;
+        typedef _value_type                     *pointer;
+        typedef _value_type                     &reference;
+
+      private: // Member variables
+        /**
+         * @brief The internal data representation of the buffer.
+         */
+        _value_type *m_data;
+
+        /**
+         * @brief The index of the first value in the data representation.
+         */
+        std::size_t m_first_valid;
+
+        /**
+         * @brief The offset of the current value from the first value.
+         */
+        difference_type m_offset;
+
+      public: // Constructors
+        /**
+         * @brief Constructs a singular iterator.
+         */
+        constexpr basic_iterator()
+            : m_data{nullptr},
+              m_first_valid{0},
+              m_offset{0}
+        {
+        }
+
+        /**
+         * @brief Constructs an iterator pointing to a value of a buffer.
+         *
+         * @param _data The internal data representation of the buffer.
+         * @param _first_valid The index of the first value.
+         * @param _offset The offset of the value from the first value.
+         */
+        constexpr basic_iterator(_value_type *_data, const std::size_t &_first_valid, const difference_type &_offset)
+            : m_data{_data},
+              m_first_valid{_first_valid},
+              m_offset{_offset}
+        {
+        }
+
+        /**
+         * @brief Converts a mutable iterator to a constant iterator.
+         */
+        template <typename _other_value_type>
+            requires std::is_same_v<const _other_value_type, _value_type> && (!std::is_same_v<_other_value_type, _value_type>)
+        constexpr basic_iterator(const basic_iterator<_other_value_type> &_other)
+            : m_data{_other.m_data},
+              m_first_valid{_other.m_first_valid},
+              m_offset{_other.m_offset}
+        {
+        }
+
+      public: // Operators
+        constexpr reference operator*() const
+        {
+            return m_data[(m_first_valid + static_cast<std::size_t>(m_offset)) % capacity];
+        }
+
+        constexpr pointer operator->() const
+        {
+            return &**this;
+        }
+
+        constexpr reference operator[](const difference_type &_offset) const
+        {
+            return *(*this + _offset);
+        }
+
+        constexpr basic_iterator &operator++()
+        {
+            ++m_offset;
+            return *this;
+        }
+
+        constexpr basic_iterator operator++(int)
+        {
+            basic_iterator copy{*this};
+            ++m_offset;
+            return copy;
+        }
+
+        constexpr basic_iterator &operator--()
+        {
+            --m_offset;
+            return *this;
+        }
+
+        constexpr basic_iterator operator--(int)
+        {
+            basic_iterator copy{*this};
+            --m_offset;
+            return copy;
+        }
+
+        constexpr basic_iterator &operator+=(const difference_type &_offset)
+        {
+            m_offset += _offset;
+            return *this;
+        }
+
+        constexpr basic_iterator &operator-=(const difference_type &_offset)
+        {
+            m_offset -= _offset;
+            return *this;
+        }
+
+        friend constexpr basic_iterator operator+(basic_iterator _iterator, const difference_type &_offset)
+        {
+            return _iterator += _offset;
+        }
+
+        friend constexpr basic_iterator operator+(const difference_type &_offset, basic_iterator _iterator)
+        {
+            return _iterator += _offset;
+        }
+
+        friend constexpr basic_iterator operator-(basic_iterator _iterator, const difference_type &_offset)
+        {
+            return _iterator -= _offset;
+        }
+
+        friend constexpr difference_type operator-(const basic_iterator &_lhs, const basic_iterator &_rhs)
+        {
+            return _lhs.m_offset - _rhs.m_offset;
+        }
+
+        friend constexpr bool operator==(const basic_iterator &_lhs, const basic_iterator &_rhs)
+        {
+            return _lhs.m_offset == _rhs.m_offset;
+        }
+
+        friend constexpr std::strong_ordering operator<=>(const basic_iterator &_lhs, const basic_iterator &_rhs)
+        {
+            return _lhs.m_offset <=> _rhs.m_offset;
+        }
+
+      private: // Friends
+        template <typename _other_value_type>
+        friend class basic_iterator;
+    };
+
+    /**
+     * @brief Iterator over the saved values.
+     */
+    typedef basic_iterator<content_type> iterator;
+
+    /**
+     * @brief Iterator over the saved values, which can not modify them.
+     */
+    typedef basic_iterator<const content_type> const_iterator;
+
   private: // Member variables
     /**
      * @brief The internal data representation.
+     *
+     * The anonymous union prevents the values from being constructed and
+     * destroyed together with the buffer. Only the slots between m_first_valid
+     * and m_first_free contain living values.
      */
-    content_type *m_data;
+    union {
+        content_type m_data[capacity];
+    };
 
     /**
      * @brief The first index in the data representation that is free.
      */
-    std::size_t m_first_free;
+    index_type m_first_free;
 
     /**
      * @brief The first index in the data representation that is valid.
      */
-    std::size_t m_first_valid;
+    index_type m_first_valid;
 
   public: // Constructors and destructor
     /**
      * @brief Constructs a circular buffer.
      */
-    circular_buffer()
-        : m_data{new content_type[capacity]},
-          m_first_free{0},
+    constexpr circular_buffer()
+        : m_first_free{0},
           m_first_valid{0}
     {
     }
@@ -58,120 +313,593 @@ class circular_buffer {
     /**
      * @brief Copy constructor.
      */
-    circular_buffer(const circular_buffer<content_type, capacity> &_other)
-        : m_data{new content_type[capacity]},
-          m_first_free{_other.m_first_free},
-          m_first_valid{_other.m_first_free}
+    constexpr circular_buffer(const circular_buffer &_other)
+        : m_first_free{static_cast<std::size_t>(_other.m_first_free)},
+          m_first_valid{static_cast<std::size_t>(_other.m_first_valid)}
     {
-        std::memcpy(m_data, _other.m_data, capacity);
+        for (std::size_t i{m_first_valid}; i != m_first_free; i = (i + 1) % capacity) {
+            std::construct_at(m_data + i, _other.m_data[i]);
+        }
     }
 
     /**
      * @brief Move constructor.
+     *
+     * The values are moved one by one, the other buffer is empty afterwards.
      */
-    circular_buffer(circular_buffer<content_type, capacity> &&_other)
-        : m_data{std::move(_other.m_data)},
-          m_first_free{std::move(_other.m_first_free)},
-          m_first_valid{std::move(_other.m_first_valid)}
+    constexpr circular_buffer(circular_buffer &&_other)
+        : m_first_free{static_cast<std::size_t>(_other.m_first_free)},
+          m_first_valid{static_cast<std::size_t>(_other.m_first_valid)}
     {
-        _other.m_data = nullptr;
+        for (std::size_t i{m_first_valid}; i != m_first_free; i = (i + 1) % capacity) {
+            std::construct_at(m_data + i, std::move(_other.m_data[i]));
+        }
+
+        _other.clear();
     }
 
     /**
-     * @brief Free buffer memory if used.
+     * @brief Destroy the saved values.
      */
-    ~circular_buffer()
+    constexpr ~circular_buffer()
     {
-        if (m_data) {
-            delete m_data;
-        }
+        clear();
     }
 
   public: // Getter
     /**
      * @brief The amount of saved data in the buffer.
      */
-    std::size_t size() const
+    constexpr std::size_t size() const
     {
-        if (m_first_free >= m_first_valid) {
-            return m_first_free - m_first_valid;
+        return size_between(load_index(m_first_valid, std::memory_order_acquire), load_index(m_first_free, std::memory_order_acquire));
+    }
+
+    /**
+     * @brief The amount of values that can be added without data loss.
+     */
+    constexpr std::size_t free_size() const
+    {
+        return capacity - 1 - size();
+    }
+
+    /**
+     * @brief The saved data as up to two contiguous segments.
+     *
+     * The first segment starts at the first value of the buffer, the second
+     * segment is only non-empty if the data wraps around the end of the
+     * internal data representation. The segments are invalidated by any
+     * modification of the buffer.
+     *
+     * @return The readable segments in buffer order.
+     */
+    constexpr std::array<readable_segment, 2> readable_segments() const
+    {
+        const std::size_t first_valid{load_index(m_first_valid, std::memory_order_relaxed)};
+        const std::size_t first_free{load_index(m_first_free, std::memory_order_acquire)};
+
+        if (first_free >= first_valid) {
+            return {readable_segment{m_data + first_valid, first_free - first_valid},
+                    readable_segment{}};
         }
 
-        return capacity - m_first_valid + m_first_free;
+        return {readable_segment{m_data + first_valid, capacity - first_valid},
+                readable_segment{m_data, first_free}};
+    }
+
+    /**
+     * @brief The free space of the buffer as up to two contiguous segments.
+     *
+     * Values written to the segments are added to the buffer by calling
+     * commit_write(). As the free slots contain no living values, this is only
+     * available for trivial content types. The segments are invalidated by any
+     * modification of the buffer.
+     *
+     * @return The writable segments in buffer order.
+     */
+    constexpr std::array<writable_segment, 2> writable_segments()
+        requires std::is_trivial_v<content_type>
+    {
+        const std::size_t first_free{load_index(m_first_free, std::memory_order_relaxed)};
+        const std::size_t count{capacity - 1 - size_between(load_index(m_first_valid, std::memory_order_acquire), first_free)};
+        const std::size_t first_count{std::min(count, capacity - first_free)};
+
+        return {writable_segment{m_data + first_free, first_count},
+                writable_segment{m_data, count - first_count}};
+    }
+
+    /**
+     * @brief Iterator to the oldest saved value.
+     */
+    constexpr iterator begin()
+    {
+        return iterator{m_data, m_first_valid, 0};
+    }
+
+    /**
+     * @brief Iterator behind the newest saved value.
+     */
+    constexpr iterator end()
+    {
+        return iterator{m_data, m_first_valid, static_cast<std::ptrdiff_t>(size())};
+    }
+
+    /**
+     * @brief Constant iterator to the oldest saved value.
+     */
+    constexpr const_iterator begin() const
+    {
+        return const_iterator{m_data, m_first_valid, 0};
+    }
+
+    /**
+     * @brief Constant iterator behind the newest saved value.
+     */
+    constexpr const_iterator end() const
+    {
+        return const_iterator{m_data, m_first_valid, static_cast<std::ptrdiff_t>(size())};
+    }
+
+    /**
+     * @brief A view over the saved values, which does not modify the buffer.
+     *
+     * The view is invalidated by any modification of the buffer. For
+     * algorithms that profit from contiguous memory, like std::reduce or
+     * loops that should be vectorized, use readable_segments() instead.
+     *
+     * @return The view from the oldest to the newest value.
+     */
+    constexpr std::ranges::subrange<const_iterator> window() const
+    {
+        return {begin(), end()};
     }
 
   public: // Functionality
     /**
      * @brief Adds a new value to the buffer.
      *
-     * Result in data loss if the buffer overflows.
+     * If the buffer is full, the behaviour depends on the overflow policy:
+     * The oldest value is overwritten, the new value is rejected or the call
+     * blocks until a consumer removed a value.
      *
      * @param _value The value that is added to the buffer.
+     * @return True if the value was added without overwriting another value.
      */
-    void push(const content_type &_value)
+    constexpr bool push(const content_type &_value)
     {
-        m_data[m_first_free] = _value;
+        bool result{true};
 
-        m_first_free = m_first_free + 1;
+        if constexpr (std::is_same_v<overflow_policy, overwrite_policy>) {
+            if (free_size() == 0) {
+                std::destroy_at(m_data + m_first_valid);
+                m_first_valid = next_index(m_first_valid);
 
-        if (m_first_free == capacity) {
-            m_first_free = 0;
+                result = false;
+            }
+        } else if constexpr (std::is_same_v<overflow_policy, reject_policy>) {
+            if (free_size() == 0) {
+                return false;
+            }
+        } else {
+            wait_until_not_full();
         }
+
+        std::construct_at(m_data + m_first_free, _value);
+        m_first_free = next_index(m_first_free);
+
+        notify_consumer();
+
+        return result;
+    }
+
+    /**
+     * @brief Adds a new value to the buffer, if the buffer is not full.
+     *
+     * Never overwrites a value or blocks, regardless of the overflow policy.
+     *
+     * @param _value The value that is added to the buffer.
+     * @return True if the value was added, false if the buffer is full.
+     */
+    constexpr bool try_push(const content_type &_value)
+    {
+        if (free_size() == 0) {
+            return false;
+        }
+
+        std::construct_at(m_data + m_first_free, _value);
+        m_first_free = next_index(m_first_free);
+
+        notify_consumer();
+
+        return true;
     }
 
     /**
      * @brief Removes the first value of the buffer and returns it.
      *
-     * Might result in UB if the buffer underflows.
+     * A blocking buffer waits for a value if it is empty, for other policies
+     * this might result in UB if the buffer underflows.
      *
      * @return The first value of the buffer.
      */
-    content_type pop()
+    constexpr content_type pop()
     {
-        content_type value = m_data[m_first_valid];
+        if constexpr (s_blocking) {
+            wait_until_not_empty();
+        }
 
-        m_first_valid = m_first_valid + 1;
+        content_type value{std::move(m_data[m_first_valid])};
 
-        if (m_first_valid == capacity) {
-            m_first_valid = 0;
-        }
+        std::destroy_at(m_data + m_first_valid);
+        m_first_valid = next_index(m_first_valid);
+
+        notify_producer();
 
         return value;
     }
 
+    /**
+     * @brief Removes the first value of the buffer, if the buffer is not
+     *        empty.
+     *
+     * Never blocks, regardless of the overflow policy.
+     *
+     * @param _value The value that is overwritten with the first value.
+     * @return True if a value was removed, false if the buffer is empty.
+     */
+    constexpr bool try_pop(content_type &_value)
+    {
+        if (size() == 0) {
+            return false;
+        }
+
+        _value = std::move(m_data[m_first_valid]);
+
+        std::destroy_at(m_data + m_first_valid);
+        m_first_valid = next_index(m_first_valid);
+
+        notify_producer();
+
+        return true;
+    }
+
+    /**
+     * @brief Adds multiple values to the buffer.
+     *
+     * The values are copied in at most two contiguous chunks. Trivially
+     * copyable values are copied using memcpy. Only as many values as there
+     * is free space are added.
+     *
+     * @param _values The values that are added to the buffer.
+     * @param _count The amount of values.
+     * @return The amount of values that were added.
+     */
+    constexpr std::size_t push_n(const content_type *_values, const std::size_t &_count)
+    {
+        const std::size_t first_free{load_index(m_first_free, std::memory_order_relaxed)};
+        const std::size_t free{capacity - 1 - size_between(load_index(m_first_valid, std::memory_order_acquire), first_free)};
+        const std::size_t count{std::min(_count, free)};
+        const std::size_t first_count{std::min(count, capacity - first_free)};
+
+        construct_values(m_data + first_free, _values, first_count);
+        construct_values(m_data, _values + first_count, count - first_count);
+
+        store_index(m_first_free, (first_free + count) % capacity, std::memory_order_release);
+
+        notify_consumer();
+
+        return count;
+    }
+
+    /**
+     * @brief Removes multiple values from the front of the buffer.
+     *
+     * The values are copied in at most two contiguous chunks. Trivially
+     * copyable values are copied using memcpy. Only as many values as are
+     * saved are removed.
+     *
+     * @param _values The destination of the removed values.
+     * @param _count The amount of values.
+     * @return The amount of values that were removed.
+     */
+    constexpr std::size_t pop_n(content_type *_values, const std::size_t &_count)
+    {
+        const std::size_t first_valid{load_index(m_first_valid, std::memory_order_relaxed)};
+        const std::size_t available{size_between(first_valid, load_index(m_first_free, std::memory_order_acquire))};
+        const std::size_t count{std::min(_count, available)};
+        const std::size_t first_count{std::min(count, capacity - first_valid)};
+
+        move_values(_values, m_data + first_valid, first_count);
+        move_values(_values + first_count, m_data, count - first_count);
+
+        commit_read(count);
+
+        return count;
+    }
+
+    /**
+     * @brief Adds values, that were written using writable_segments(), to the
+     *        buffer.
+     *
+     * @param _count The amount of written values. Must not be bigger than
+     *               free_size().
+     */
+    constexpr void commit_write(const std::size_t &_count)
+        requires std::is_trivial_v<content_type>
+    {
+        store_index(m_first_free, (load_index(m_first_free, std::memory_order_relaxed) + _count) % capacity, std::memory_order_release);
+
+        notify_consumer();
+    }
+
+    /**
+     * @brief Removes values, that were read using readable_segments(), from
+     *        the buffer.
+     *
+     * @param _count The amount of read values. Must not be bigger than size().
+     */
+    constexpr void commit_read(const std::size_t &_count)
+    {
+        const std::size_t first_valid{load_index(m_first_valid, std::memory_order_relaxed)};
+
+        if constexpr (!std::is_trivially_destructible_v<content_type>) {
+            for (std::size_t i{0}; i < _count; ++i) {
+                std::destroy_at(m_data + (first_valid + i) % capacity);
+            }
+        }
+
+        store_index(m_first_valid, (first_valid + _count) % capacity, std::memory_order_release);
+
+        notify_producer();
+    }
+
+    /**
+     * @brief Removes all values from the buffer.
+     */
+    constexpr void clear()
+    {
+        commit_read(size());
+
+        m_first_free  = 0;
+        m_first_valid = 0;
+    }
+
+  private: // Functionality
+    /**
+     * @brief Blocks until the buffer has at least one free slot.
+     */
+    void wait_until_not_full()
+    {
+        std::size_t first_valid{m_first_valid.load(std::memory_order_acquire)};
+
+        while (next_index(m_first_free.load(std::memory_order_relaxed)) == first_valid) {
+            m_first_valid.wait(first_valid, std::memory_order_acquire);
+            first_valid = m_first_valid.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Blocks until the buffer has at least one value.
+     */
+    void wait_until_not_empty()
+    {
+        std::size_t first_free{m_first_free.load(std::memory_order_acquire)};
+
+        while (m_first_valid.load(std::memory_order_relaxed) == first_free) {
+            m_first_free.wait(first_free, std::memory_order_acquire);
+            first_free = m_first_free.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Wakes up a consumer waiting for a value.
+     *
+     * Does nothing if the buffer does not block.
+     */
+    constexpr void notify_consumer()
+    {
+        if constexpr (s_blocking) {
+            m_first_free.notify_one();
+        }
+    }
+
+    /**
+     * @brief Wakes up a producer waiting for a free slot.
+     *
+     * Does nothing if the buffer does not block.
+     */
+    constexpr void notify_producer()
+    {
+        if constexpr (s_blocking) {
+            m_first_valid.notify_one();
+        }
+    }
+
+  private: // Static functionality
+    /**
+     * @brief The index following the given index.
+     *
+     * @param _index The current index.
+     * @return The next index, wrapped to the start of the data representation.
+     */
+    static constexpr std::size_t next_index(const std::size_t &_index)
+    {
+        if (_index + 1 == capacity) {
+            return 0;
+        }
+
+        return _index + 1;
+    }
+
+    /**
+     * @brief The amount of values between two index snapshots.
+     *
+     * @param _first_valid The first valid index.
+     * @param _first_free The first free index.
+     * @return The amount of saved values, which is smaller than the capacity.
+     */
+    static constexpr std::size_t size_between(const std::size_t &_first_valid, const std::size_t &_first_free)
+    {
+        if (_first_free >= _first_valid) {
+            return _first_free - _first_valid;
+        }
+
+        return capacity - _first_valid + _first_free;
+    }
+
+    /**
+     * @brief Reads an index, which is only synchronized if the buffer blocks.
+     *
+     * @param _index The index.
+     * @param _order The memory order of a blocking buffer.
+     * @return The value of the index.
+     */
+    static constexpr std::size_t load_index(const index_type &_index, [[maybe_unused]] const std::memory_order &_order)
+    {
+        if constexpr (s_blocking) {
+            return _index.load(_order);
+        } else {
+            return _index;
+        }
+    }
+
+    /**
+     * @brief Writes an index, which is only synchronized if the buffer blocks.
+     *
+     * @param _index The index.
+     * @param _value The new value of the index.
+     * @param _order The memory order of a blocking buffer.
+     */
+    static constexpr void store_index(index_type &_index, const std::size_t &_value, [[maybe_unused]] const std::memory_order &_order)
+    {
+        if constexpr (s_blocking) {
+            _index.store(_value, _order);
+        } else {
+            _index = _value;
+        }
+    }
+
+    /**
+     * @brief Copies a contiguous range of values into free slots.
+     *
+     * @param _destination The first free slot that is initialized.
+     * @param _source The first value that is copied.
+     * @param _count The amount of values.
+     */
+    static constexpr void construct_values(content_type *_destination, const content_type *_source, const std::size_t &_count)
+    {
+        if constexpr (std::is_trivially_copyable_v<content_type>) {
+            if (!std::is_constant_evaluated()) {
+                if (_count > 0) {
+                    std::memcpy(_destination, _source, _count * sizeof(content_type));
+                }
+
+                return;
+            }
+        }
+
+        for (std::size_t i{0}; i < _count; ++i) {
+            std::construct_at(_destination + i, _source[i]);
+        }
+    }
+
+    /**
+     * @brief Moves a contiguous range of saved values out of the buffer.
+     *
+     * The saved values are not destroyed.
+     *
+     * @param _destination The first value that is overwritten.
+     * @param _source The first saved value that is moved.
+     * @param _count The amount of values.
+     */
+    static constexpr void move_values(content_type *_destination, content_type *_source, const std::size_t &_count)
+    {
+        if constexpr (std::is_trivially_copyable_v<content_type>) {
+            if (!std::is_constant_evaluated()) {
+                if (_count > 0) {
+                    std::memcpy(_destination, _source, _count * sizeof(content_type));
+                }
+
+                return;
+            }
+        }
+
+        std::move(_source, _source + _count, _destination);
+    }
+
   public: // Operators
+    /**
+     * @brief Get a reference to the saved value at a given position.
+     *
+     * The position zero is the oldest saved value. The access is unchecked.
+     * Beware of undefined behaviour if the position is not within the buffer
+     * bounds (0 <= position < size()).
+     *
+     * @param _position The position that should be accessed.
+     * @return Reference to the value at the given position.
+     */
+    constexpr content_type &operator[](const std::size_t &_position)
+    {
+        return m_data[(m_first_valid + _position) % capacity];
+    }
+
+    /**
+     * @brief Get a constant reference to the saved value at a given position.
+     *
+     * The position zero is the oldest saved value. The access is unchecked.
+     * Beware of undefined behaviour if the position is not within the buffer
+     * bounds (0 <= position < size()).
+     *
+     * @param _position The position that should be accessed.
+     * @return Constant reference to the value at the given position.
+     */
+    constexpr const content_type &operator[](const std::size_t &_position) const
+    {
+        return m_data[(m_first_valid + _position) % capacity];
+    }
+
     /**
      * @brief Assignment operator.
      */
-    circular_buffer &operator=(const circular_buffer<content_type, capacity> &_other)
+    constexpr circular_buffer &operator=(const circular_buffer &_other)
     {
-        if (m_data) {
-            delete m_data;
+        if (this == &_other) {
+            return *this;
         }
 
-        m_data        = new content_type[capacity];
-        m_first_free  = _other.m_first_free;
-        m_first_valid = _other.m_first_valid;
+        clear();
 
-        std::memcpy(m_data, _other.m_data, capacity);
+        m_first_free  = static_cast<std::size_t>(_other.m_first_free);
+        m_first_valid = static_cast<std::size_t>(_other.m_first_valid);
+
+        for (std::size_t i{m_first_valid}; i != m_first_free; i = (i + 1) % capacity) {
+            std::construct_at(m_data + i, _other.m_data[i]);
+        }
 
         return *this;
     }
 
     /**
      * @brief Move operator.
+     *
+     * The values are moved one by one, the other buffer is empty afterwards.
      */
-    circular_buffer &operator=(circular_buffer<content_type, capacity> &&_other)
+    constexpr circular_buffer &operator=(circular_buffer &&_other)
     {
-        if (m_data) {
-            delete m_data;
+        if (this == &_other) {
+            return *this;
         }
 
-        m_data        = std::move(_other.m_data);
-        m_first_free  = std::move(_other.m_first_free);
-        m_first_valid = std::move(_other.m_first_valid);
+        clear();
+
+        m_first_free  = static_cast<std::size_t>(_other.m_first_free);
+        m_first_valid = static_cast<std::size_t>(_other.m_first_valid);
+
+        for (std::size_t i{m_first_valid}; i != m_first_free; i = (i + 1) % capacity) {
+            std::construct_at(m_data + i, std::move(_other.m_data[i]));
+        }
 
-        _other.m_data = nullptr;
+        _other.clear();
 
         return *this;
     }
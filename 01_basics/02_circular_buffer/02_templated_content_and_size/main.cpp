@@ -1,27 +1,82 @@
 // SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <thread>
 
 #include "circular_buffer.hpp"
 
 /**
  * @brief Print the content of the circular buffer.
  *
+ * The buffer is iterated without removing the values.
+ *
  * @param _buffer The circular buffer.
  */
-template <typename _content_type, std::size_t _capacity>
-void print_buffer(circular_buffer<_content_type, _capacity> &_buffer)
+template <typename _content_type, std::size_t _capacity, typename _overflow_policy>
+void print_buffer(const circular_buffer<_content_type, _capacity, _overflow_policy> &_buffer)
 {
     std::cout << "[";
 
-    while (_buffer.size()) {
-        std::cout << ' ' << _buffer.pop();
+    for (const _content_type &value : _buffer) {
+        std::cout << ' ' << value;
     }
 
     std::cout << " ]\n";
 }
 
+/**
+ * @brief Calculates the mean of the saved values.
+ *
+ * Each of the two contiguous segments is reduced on its own, which allows
+ * the compiler to vectorize the reduction.
+ *
+ * @param _buffer The circular buffer.
+ * @return The mean of the saved values.
+ */
+template <typename _content_type, std::size_t _capacity, typename _overflow_policy>
+double mean(const circular_buffer<_content_type, _capacity, _overflow_policy> &_buffer)
+{
+    double sum{0.0};
+
+    for (const auto &segment : _buffer.readable_segments()) {
+        sum = std::reduce(segment.begin(), segment.end(), sum);
+    }
+
+    return sum / static_cast<double>(_buffer.size());
+}
+
+/**
+ * @brief Sums up the values -5 to 5 using a circular buffer.
+ *
+ * As the buffer does not allocate, this can be done at compile time.
+ *
+ * @return The sum of the values.
+ */
+constexpr int sum_in_buffer()
+{
+    circular_buffer<int, 4> buffer{};
+
+    int sum{0};
+    for (int i{-5}; i <= 5; ++i) {
+        buffer.push(i);
+
+        if (buffer.size() == 3) {
+            sum += buffer.pop();
+        }
+    }
+
+    while (buffer.size()) {
+        sum += buffer.pop();
+    }
+
+    return sum;
+}
+
+static_assert(sum_in_buffer() == 0, "The buffer is usable in constant expressions.");
+
 /**
  * @brief The main function.
  *
@@ -37,5 +92,81 @@ int main()
 
     print_buffer(buffer);
 
+    buffer.clear();
+
+    int values[15];
+    for (std::size_t i{0}; i < 15; ++i) {
+        values[i] = -7 + static_cast<int>(i);
+    }
+
+    buffer.push_n(values, 15);
+
+    print_buffer(buffer);
+
+    std::cout << "Mean " << mean(buffer) << ", maximum " << *std::ranges::max_element(buffer.window()) << ", newest " << buffer[buffer.size() - 1] << "\n";
+
+    circular_buffer<int, 8, overwrite_policy> overwriting_buffer{};
+    circular_buffer<int, 8, reject_policy>    rejecting_buffer{};
+
+    for (int i{-5}; i <= 5; ++i) {
+        overwriting_buffer.push(i);
+        rejecting_buffer.push(i);
+    }
+
+    print_buffer(overwriting_buffer);
+    print_buffer(rejecting_buffer);
+
+    circular_buffer<int, 4, block_policy> blocking_buffer{};
+
+    std::thread producer{[&blocking_buffer]() {
+        for (int i{-5}; i <= 5; ++i) {
+            blocking_buffer.push(i);
+        }
+    }};
+
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < 11; ++i) {
+        std::cout << ' ' << blocking_buffer.pop();
+    }
+
+    std::cout << " ]\n";
+
+    producer.join();
+
+    // Bulk operations wake up threads blocked by single operations as well.
+    std::thread bulk_producer{[&blocking_buffer, &values]() {
+        std::size_t pushed{0};
+        while (pushed < 11) {
+            pushed += blocking_buffer.push_n(values + pushed, 11 - pushed);
+            std::this_thread::yield();
+        }
+
+        for (int i{-5}; i <= 5; ++i) {
+            blocking_buffer.push(i);
+        }
+    }};
+
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < 11; ++i) {
+        std::cout << ' ' << blocking_buffer.pop();
+    }
+
+    int         popped_values[11];
+    std::size_t popped{0};
+    while (popped < 11) {
+        popped += blocking_buffer.pop_n(popped_values + popped, 11 - popped);
+        std::this_thread::yield();
+    }
+
+    for (const int &value : popped_values) {
+        std::cout << ' ' << value;
+    }
+
+    std::cout << " ]\n";
+
+    bulk_producer.join();
+
     return 0;
 }
\ No newline at end of file
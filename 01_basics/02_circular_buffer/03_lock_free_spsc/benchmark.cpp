@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "circular_buffer.hpp"
+
+/**
+ * @brief The buffer type used for the benchmark.
+ */
+typedef circular_buffer<std::uint64_t, 1024> buffer_type;
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Pushes a value and spins until the buffer accepted it.
+ *
+ * @param _buffer The circular buffer.
+ * @param _value The value that is added to the buffer.
+ */
+void blocking_push(buffer_type &_buffer, const std::uint64_t &_value)
+{
+    while (!_buffer.try_push(_value)) {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Spins until a value could be removed from the buffer.
+ *
+ * @param _buffer The circular buffer.
+ * @return The first value of the buffer.
+ */
+std::uint64_t blocking_pop(buffer_type &_buffer)
+{
+    std::uint64_t value{0};
+    while (!_buffer.try_pop(value)) {
+        std::this_thread::yield();
+    }
+
+    return value;
+}
+
+/**
+ * @brief Measures how many values per second are handed from one producer
+ *        thread to one consumer thread.
+ *
+ * @param _count The amount of values that are handed over.
+ */
+void benchmark_throughput(const std::uint64_t &_count)
+{
+    static buffer_type buffer{};
+
+    std::uint64_t sum{0};
+
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    std::thread consumer{[&sum, &_count]() {
+        for (std::uint64_t i{0}; i < _count; ++i) {
+            sum += blocking_pop(buffer);
+        }
+    }};
+
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        blocking_push(buffer, i);
+    }
+
+    consumer.join();
+
+    const std::chrono::duration<double> elapsed{benchmark_clock::now() - start};
+
+    if (sum != _count * (_count - 1) / 2) {
+        std::cerr << "Throughput benchmark lost values.\n";
+        std::exit(1);
+    }
+
+    std::cout << "throughput: " << _count << " values in " << elapsed.count() << " s ("
+              << static_cast<double>(_count) / elapsed.count() << " values/s)\n";
+}
+
+/**
+ * @brief Measures the round trip time of a value sent to another thread and
+ *        back again, using one buffer for each direction.
+ *
+ * @param _count The amount of round trips.
+ */
+void benchmark_latency(const std::uint64_t &_count)
+{
+    static buffer_type ping{};
+    static buffer_type pong{};
+
+    std::thread echo{[&_count]() {
+        for (std::uint64_t i{0}; i < _count; ++i) {
+            blocking_push(pong, blocking_pop(ping));
+        }
+    }};
+
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        blocking_push(ping, i);
+        if (blocking_pop(pong) != i) {
+            std::cerr << "Latency benchmark received an unexpected value.\n";
+            std::exit(1);
+        }
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    echo.join();
+
+    std::cout << "latency: " << _count << " round trips, "
+              << elapsed.count() / static_cast<double>(_count) / 2.0 << " ns per handoff\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of values used for the
+ * throughput benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t count{10000000};
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    benchmark_throughput(count);
+    benchmark_latency(count / 100 + 1);
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef CIRCULAR_BUFFER_HPP_
+#define CIRCULAR_BUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief A templated lock-free circular buffer for exactly one producer and
+ *        one consumer thread.
+ *
+ * The producer only writes the head index and the consumer only writes the
+ * tail index, so both sides can work without a lock. The indices are never
+ * wrapped, instead they are masked when accessing the data. This requires the
+ * capacity to be a power of two.
+ */
+template <typename _content_type, std::size_t _capacity>
+class circular_buffer {
+  public: // Asserts
+    /**
+     * @brief Verify that the capacity is bigger then zero.
+     */
+    static_assert(_capacity > 0, "The buffer capacity is required to be bigger than zero.");
+
+    /**
+     * @brief Verify that the capacity is a power of two.
+     */
+    static_assert((_capacity & (_capacity - 1)) == 0, "The buffer capacity is required to be a power of two.");
+
+  public: // Typedefs
+    /**
+     * @brief The content type of the buffer.
+     */
+    typedef _content_type content_type;
+
+  public: // Static member variables
+    static const constexpr std::size_t capacity{_capacity};
+
+  private: // Static member variables
+    /**
+     * @brief The mask used to map an index into the data representation.
+     */
+    static const constexpr std::size_t s_index_mask{_capacity - 1};
+
+    /**
+     * @brief The assumed size of a cache line.
+     *
+     * Members written by different threads are placed on different cache lines
+     * to avoid false sharing.
+     */
+    static const constexpr std::size_t s_cache_line_size{64};
+
+  private: // Member variables
+    /**
+     * @brief The first index in the data representation that is free.
+     *
+     * Only written by the producer.
+     */
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_first_free;
+
+    /**
+     * @brief The last value of m_first_valid seen by the producer.
+     *
+     * Only the producer uses this value, so it can stay in the producers
+     * cache line.
+     */
+    std::size_t m_cached_first_valid;
+
+    /**
+     * @brief The first index in the data representation that is valid.
+     *
+     * Only written by the consumer.
+     */
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_first_valid;
+
+    /**
+     * @brief The last value of m_first_free seen by the consumer.
+     *
+     * Only the consumer uses this value, so it can stay in the consumers
+     * cache line.
+     */
+    std::size_t m_cached_first_free;
+
+    /**
+     * @brief The internal data representation.
+     */
+    alignas(s_cache_line_size) content_type *const m_data;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs a circular buffer.
+     */
+    circular_buffer()
+        : m_first_free{0},
+          m_cached_first_valid{0},
+          m_first_valid{0},
+          m_cached_first_free{0},
+          m_data{new content_type[capacity]}
+    {
+    }
+
+    /**
+     * @brief The buffer is shared between threads and can not be copied.
+     */
+    circular_buffer(const circular_buffer<content_type, capacity> &_other) = delete;
+
+    /**
+     * @brief The buffer is shared between threads and can not be moved.
+     */
+    circular_buffer(circular_buffer<content_type, capacity> &&_other) = delete;
+
+    /**
+     * @brief Free buffer memory.
+     */
+    ~circular_buffer()
+    {
+        delete[] m_data;
+    }
+
+  public: // Getter
+    /**
+     * @brief The amount of saved data in the buffer.
+     *
+     * If the buffer is used by another thread, the value might be outdated as
+     * soon as it is returned.
+     */
+    std::size_t size() const
+    {
+        const std::size_t first_valid{m_first_valid.load(std::memory_order_acquire)};
+        const std::size_t first_free{m_first_free.load(std::memory_order_acquire)};
+
+        return first_free - first_valid;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Adds a new value to the buffer.
+     *
+     * Must only be called by the producer thread.
+     *
+     * @param _value The value that is added to the buffer.
+     * @return True if the value was added, false if the buffer is full.
+     */
+    bool try_push(const content_type &_value)
+    {
+        const std::size_t first_free{m_first_free.load(std::memory_order_relaxed)};
+
+        if (first_free - m_cached_first_valid == capacity) {
+            m_cached_first_valid = m_first_valid.load(std::memory_order_acquire);
+
+            if (first_free - m_cached_first_valid == capacity) {
+                return false;
+            }
+        }
+
+        m_data[first_free & s_index_mask] = _value;
+
+        m_first_free.store(first_free + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Removes the first value of the buffer.
+     *
+     * Must only be called by the consumer thread.
+     *
+     * @param _value The value that is overwritten with the first value.
+     * @return True if a value was removed, false if the buffer is empty.
+     */
+    bool try_pop(content_type &_value)
+    {
+        const std::size_t first_valid{m_first_valid.load(std::memory_order_relaxed)};
+
+        if (first_valid == m_cached_first_free) {
+            m_cached_first_free = m_first_free.load(std::memory_order_acquire);
+
+            if (first_valid == m_cached_first_free) {
+                return false;
+            }
+        }
+
+        _value = m_data[first_valid & s_index_mask];
+
+        m_first_valid.store(first_valid + 1, std::memory_order_release);
+
+        return true;
+    }
+
+  public: // Operators
+    /**
+     * @brief The buffer is shared between threads and can not be assigned.
+     */
+    circular_buffer &operator=(const circular_buffer<content_type, capacity> &_other) = delete;
+
+    /**
+     * @brief The buffer is shared between threads and can not be moved.
+     */
+    circular_buffer &operator=(circular_buffer<content_type, capacity> &&_other) = delete;
+};
+
+#endif // CIRCULAR_BUFFER_HPP_
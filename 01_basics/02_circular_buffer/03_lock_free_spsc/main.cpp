@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <thread>
+
+#include "circular_buffer.hpp"
+
+/**
+ * @brief Print the values produced by another thread.
+ *
+ * @param _buffer The circular buffer.
+ * @param _count The amount of values that are expected.
+ */
+template <typename _content_type, std::size_t _capacity>
+void print_buffer(circular_buffer<_content_type, _capacity> &_buffer, std::size_t _count)
+{
+    std::cout << "[";
+
+    _content_type value{};
+    while (_count) {
+        if (_buffer.try_pop(value)) {
+            std::cout << ' ' << value;
+            --_count;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    std::cout << " ]\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * @return The exit status.
+ */
+int main()
+{
+    circular_buffer<int, 4> buffer{};
+
+    std::thread producer{[&buffer]() {
+        for (int i{0}; i < 11; ++i) {
+            while (!buffer.try_push(-5 + i)) {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    print_buffer(buffer, 11);
+
+    producer.join();
+
+    return 0;
+}
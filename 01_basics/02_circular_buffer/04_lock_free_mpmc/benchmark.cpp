@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "circular_buffer.hpp"
+
+/**
+ * @brief The buffer type used for the benchmark.
+ */
+typedef circular_buffer<std::uint64_t, 1024> buffer_type;
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Measures how many values per second are handed over from a given
+ *        amount of producers to the same amount of consumers.
+ *
+ * @param _threads The amount of producer and of consumer threads.
+ * @param _count The amount of values each producer hands over.
+ */
+void benchmark_scaling(const std::size_t &_threads, const std::uint64_t &_count)
+{
+    static buffer_type buffer{};
+
+    std::atomic<bool>          start_flag{false};
+    std::atomic<std::uint64_t> sum{0};
+    std::vector<std::thread>   threads{};
+
+    for (std::size_t i{0}; i < _threads; ++i) {
+        threads.emplace_back([&start_flag, &_count]() {
+            while (!start_flag.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            for (std::uint64_t value{0}; value < _count; ++value) {
+                while (!buffer.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        threads.emplace_back([&start_flag, &sum, &_count]() {
+            while (!start_flag.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            std::uint64_t local_sum{0};
+            std::uint64_t value{0};
+            for (std::uint64_t received{0}; received < _count; ++received) {
+                while (!buffer.try_pop(value)) {
+                    std::this_thread::yield();
+                }
+
+                local_sum += value;
+            }
+
+            sum.fetch_add(local_sum, std::memory_order_relaxed);
+        });
+    }
+
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+    start_flag.store(true, std::memory_order_release);
+
+    for (std::size_t i{0}; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    const std::chrono::duration<double> elapsed{benchmark_clock::now() - start};
+
+    if (sum.load() != _threads * (_count * (_count - 1) / 2)) {
+        std::cerr << "Scaling benchmark lost values.\n";
+        std::exit(1);
+    }
+
+    const double operations{static_cast<double>(2 * _threads * _count)};
+
+    std::cout << _threads << " producers / " << _threads << " consumers: "
+              << operations / elapsed.count() << " ops/s, "
+              << operations / elapsed.count() / static_cast<double>(2 * _threads) << " ops/s per thread\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of values each producer hands
+ * over, the second optional argument is the maximum amount of producers and
+ * consumers.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t count{1000000};
+    std::size_t   max_threads{std::thread::hardware_concurrency()};
+
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    if (_argc > 2) {
+        max_threads = std::strtoull(_argv[2], nullptr, 10);
+    }
+
+    if (max_threads == 0) {
+        max_threads = 1;
+    }
+
+    for (std::size_t threads{1}; threads <= max_threads; ++threads) {
+        benchmark_scaling(threads, count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef CIRCULAR_BUFFER_HPP_
+#define CIRCULAR_BUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief A templated bounded circular buffer for multiple producer and
+ *        multiple consumer threads.
+ *
+ * Every slot stores a sequence number next to its value. The sequence number
+ * tells whether the slot is ready to be written or read for the current lap
+ * around the buffer, so a thread claims a slot with a single compare and swap
+ * on the shared index and never takes a lock.
+ */
+template <typename _content_type, std::size_t _capacity>
+class circular_buffer {
+  public: // Asserts
+    /**
+     * @brief Verify that the capacity is bigger then zero.
+     */
+    static_assert(_capacity > 0, "The buffer capacity is required to be bigger than zero.");
+
+  public: // Typedefs
+    /**
+     * @brief The content type of the buffer.
+     */
+    typedef _content_type content_type;
+
+  public: // Static member variables
+    static const constexpr std::size_t capacity{_capacity};
+
+  private: // Static member variables
+    /**
+     * @brief The assumed size of a cache line.
+     *
+     * Members written by different threads are placed on different cache lines
+     * to avoid false sharing.
+     */
+    static const constexpr std::size_t s_cache_line_size{64};
+
+  private: // Inner class
+    /**
+     * @brief A single slot of the buffer.
+     */
+    struct slot {
+        /**
+         * @brief The sequence number of the slot.
+         *
+         * If it equals the position of a producer the slot is free, if it is
+         * one ahead of the position of a consumer the slot holds a value.
+         */
+        std::atomic<std::size_t> sequence;
+
+        /**
+         * @brief The value stored in the slot.
+         */
+        content_type value;
+    };
+
+  private: // Member variables
+    /**
+     * @brief The next position claimed by a producer.
+     */
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_first_free;
+
+    /**
+     * @brief The next position claimed by a consumer.
+     */
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_first_valid;
+
+    /**
+     * @brief The internal data representation.
+     */
+    alignas(s_cache_line_size) slot *const m_data;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs a circular buffer.
+     */
+    circular_buffer()
+        : m_first_free{0},
+          m_first_valid{0},
+          m_data{new slot[capacity]}
+    {
+        for (std::size_t i{0}; i < capacity; ++i) {
+            m_data[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief The buffer is shared between threads and can not be copied.
+     */
+    circular_buffer(const circular_buffer<content_type, capacity> &_other) = delete;
+
+    /**
+     * @brief The buffer is shared between threads and can not be moved.
+     */
+    circular_buffer(circular_buffer<content_type, capacity> &&_other) = delete;
+
+    /**
+     * @brief Free buffer memory.
+     */
+    ~circular_buffer()
+    {
+        delete[] m_data;
+    }
+
+  public: // Getter
+    /**
+     * @brief The amount of saved data in the buffer.
+     *
+     * If the buffer is used by other threads, the value is only an estimate.
+     */
+    std::size_t size() const
+    {
+        const std::size_t first_valid{m_first_valid.load(std::memory_order_acquire)};
+        const std::size_t first_free{m_first_free.load(std::memory_order_acquire)};
+
+        return first_free > first_valid ? first_free - first_valid : 0;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Adds a new value to the buffer.
+     *
+     * Can be called by any amount of threads at the same time.
+     *
+     * @param _value The value that is added to the buffer.
+     * @return True if the value was added, false if the buffer is full.
+     */
+    bool try_push(const content_type &_value)
+    {
+        std::size_t position{m_first_free.load(std::memory_order_relaxed)};
+
+        for (;;) {
+            slot             &current{m_data[position % capacity]};
+            const std::size_t sequence{current.sequence.load(std::memory_order_acquire)};
+
+            if (sequence == position) {
+                if (m_first_free.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    current.value = _value;
+                    current.sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+            } else if (sequence < position) {
+                return false;
+            } else {
+                position = m_first_free.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the first value of the buffer.
+     *
+     * Can be called by any amount of threads at the same time.
+     *
+     * @param _value The value that is overwritten with the first value.
+     * @return True if a value was removed, false if the buffer is empty.
+     */
+    bool try_pop(content_type &_value)
+    {
+        std::size_t position{m_first_valid.load(std::memory_order_relaxed)};
+
+        for (;;) {
+            slot             &current{m_data[position % capacity]};
+            const std::size_t sequence{current.sequence.load(std::memory_order_acquire)};
+
+            if (sequence == position + 1) {
+                if (m_first_valid.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    _value = current.value;
+                    current.sequence.store(position + capacity, std::memory_order_release);
+
+                    return true;
+                }
+            } else if (sequence < position + 1) {
+                return false;
+            } else {
+                position = m_first_valid.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+  public: // Operators
+    /**
+     * @brief The buffer is shared between threads and can not be assigned.
+     */
+    circular_buffer &operator=(const circular_buffer<content_type, capacity> &_other) = delete;
+
+    /**
+     * @brief The buffer is shared between threads and can not be moved.
+     */
+    circular_buffer &operator=(circular_buffer<content_type, capacity> &&_other) = delete;
+};
+
+#endif // CIRCULAR_BUFFER_HPP_
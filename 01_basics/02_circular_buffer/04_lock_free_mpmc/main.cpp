@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "circular_buffer.hpp"
+
+/**
+ * @brief Pushes a range of values into the buffer.
+ *
+ * @param _buffer The circular buffer.
+ * @param _first The first value that is pushed.
+ * @param _last The value after the last value that is pushed.
+ */
+template <typename _content_type, std::size_t _capacity>
+void produce(circular_buffer<_content_type, _capacity> &_buffer, _content_type _first, const _content_type &_last)
+{
+    for (; _first < _last; ++_first) {
+        while (!_buffer.try_push(_first)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Removes values from the buffer.
+ *
+ * @param _buffer The circular buffer.
+ * @param _values The removed values.
+ * @param _count The amount of values that are removed.
+ */
+template <typename _content_type, std::size_t _capacity>
+void consume(circular_buffer<_content_type, _capacity> &_buffer, std::vector<_content_type> &_values, std::size_t _count)
+{
+    _content_type value{};
+    while (_count) {
+        if (_buffer.try_pop(value)) {
+            _values.push_back(value);
+            --_count;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Print the given values.
+ *
+ * @param _values The values that are printed.
+ */
+template <typename _content_type>
+void print_values(const std::vector<_content_type> &_values)
+{
+    std::cout << "[";
+
+    for (std::size_t i{0}; i < _values.size(); ++i) {
+        std::cout << ' ' << _values[i];
+    }
+
+    std::cout << " ]\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * Two producers and two consumers share one buffer. As the order between
+ * the threads is not defined, the received values are sorted before printing.
+ *
+ * @return The exit status.
+ */
+int main()
+{
+    circular_buffer<int, 3> buffer{};
+
+    std::vector<int> first_values{};
+    std::vector<int> second_values{};
+
+    std::thread first_producer{[&buffer]() { produce(buffer, -5, 0); }};
+    std::thread second_producer{[&buffer]() { produce(buffer, 0, 6); }};
+    std::thread first_consumer{[&buffer, &first_values]() { consume(buffer, first_values, 5); }};
+    std::thread second_consumer{[&buffer, &second_values]() { consume(buffer, second_values, 6); }};
+
+    first_producer.join();
+    second_producer.join();
+    first_consumer.join();
+    second_consumer.join();
+
+    first_values.insert(first_values.end(), second_values.begin(), second_values.end());
+    std::sort(first_values.begin(), first_values.end());
+
+    print_values(first_values);
+
+    return 0;
+}
@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef CIRCULAR_BUFFER_HPP_
+#define CIRCULAR_BUFFER_HPP_
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @brief A templated circular buffer, whose memory is mapped twice back to
+ *        back.
+ *
+ * Accessing the data behind the end of the first mapping accesses the start
+ * of the data again. Therefore the saved values and the free space are always
+ * contiguous in memory, even if they wrap around the end of the buffer, and
+ * can be accessed in place using read_ptr() and write_ptr().
+ *
+ * The capacity is rounded up, so that the buffer fills whole pages. As the
+ * values are accessed as raw memory, the content type is required to be
+ * trivially copyable.
+ */
+template <typename _content_type>
+class circular_buffer {
+  public: // Asserts
+    /**
+     * @brief Verify that the content can be accessed as raw memory.
+     */
+    static_assert(std::is_trivially_copyable<_content_type>::value, "The content type is required to be trivially copyable.");
+
+  public: // Typedefs
+    /**
+     * @brief The content type of the buffer.
+     */
+    typedef _content_type content_type;
+
+  private: // Member variables
+    /**
+     * @brief The size of one mapping in bytes.
+     */
+    std::size_t m_byte_size;
+
+    /**
+     * @brief The internal data representation, mapped twice.
+     */
+    content_type *m_data;
+
+    /**
+     * @brief The amount of values ever added to the buffer.
+     *
+     * The first free index is the value modulo the capacity.
+     */
+    std::size_t m_first_free;
+
+    /**
+     * @brief The amount of values ever removed from the buffer.
+     *
+     * The first valid index is the value modulo the capacity.
+     */
+    std::size_t m_first_valid;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs a circular buffer.
+     *
+     * Throws a std::system_error if the memory can not be mapped.
+     *
+     * @param _capacity The minimal capacity of the buffer.
+     */
+    explicit circular_buffer(const std::size_t &_capacity)
+        : m_byte_size{byte_size_for(_capacity)},
+          m_data{map(m_byte_size)},
+          m_first_free{0},
+          m_first_valid{0}
+    {
+    }
+
+    /**
+     * @brief Copy constructor.
+     */
+    circular_buffer(const circular_buffer<content_type> &_other)
+        : m_byte_size{_other.m_byte_size},
+          m_data{map(m_byte_size)},
+          m_first_free{_other.m_first_free},
+          m_first_valid{_other.m_first_valid}
+    {
+        std::memcpy(m_data, _other.m_data, m_byte_size);
+    }
+
+    /**
+     * @brief Move constructor.
+     */
+    circular_buffer(circular_buffer<content_type> &&_other)
+        : m_byte_size{_other.m_byte_size},
+          m_data{_other.m_data},
+          m_first_free{_other.m_first_free},
+          m_first_valid{_other.m_first_valid}
+    {
+        _other.m_data = nullptr;
+    }
+
+    /**
+     * @brief Unmap the buffer memory if used.
+     */
+    ~circular_buffer()
+    {
+        unmap();
+    }
+
+  public: // Getter
+    /**
+     * @brief The potential capacity of the buffer.
+     */
+    std::size_t capacity() const
+    {
+        return m_byte_size / sizeof(content_type);
+    }
+
+    /**
+     * @brief The amount of saved data in the buffer.
+     */
+    std::size_t size() const
+    {
+        return m_first_free - m_first_valid;
+    }
+
+    /**
+     * @brief Pointer to the first value of the buffer.
+     *
+     * All size() saved values are contiguous starting at the pointer.
+     */
+    const content_type *read_ptr() const
+    {
+        return m_data + m_first_valid % capacity();
+    }
+
+    /**
+     * @brief Pointer to the first free value of the buffer.
+     *
+     * All capacity() - size() free values are contiguous starting at the
+     * pointer. Written values are added to the buffer by calling
+     * commit_write().
+     */
+    content_type *write_ptr()
+    {
+        return m_data + m_first_free % capacity();
+    }
+
+  public: // Functionality
+    /**
+     * @brief Adds a new value to the buffer.
+     *
+     * If the buffer is full, the oldest value is overwritten.
+     *
+     * @param _value The value that is added to the buffer.
+     */
+    void push(const content_type &_value)
+    {
+        if (size() == capacity()) {
+            ++m_first_valid;
+        }
+
+        *write_ptr() = _value;
+
+        ++m_first_free;
+    }
+
+    /**
+     * @brief Removes the first value of the buffer and returns it.
+     *
+     * Might result in UB if the buffer underflows.
+     *
+     * @return The first value of the buffer.
+     */
+    content_type pop()
+    {
+        const content_type value{*read_ptr()};
+
+        ++m_first_valid;
+
+        return value;
+    }
+
+    /**
+     * @brief Removes values, that were read using read_ptr(), from the buffer.
+     *
+     * @param _count The amount of read values. Must not be bigger than size().
+     */
+    void commit_read(const std::size_t &_count)
+    {
+        m_first_valid += _count;
+    }
+
+    /**
+     * @brief Adds values, that were written using write_ptr(), to the buffer.
+     *
+     * @param _count The amount of written values. Must not be bigger than
+     *               capacity() - size().
+     */
+    void commit_write(const std::size_t &_count)
+    {
+        m_first_free += _count;
+    }
+
+  private: // Static functionality
+    /**
+     * @brief Throws a std::system_error for the current errno.
+     *
+     * @param _what The failed operation.
+     */
+    [[noreturn]] static void throw_system_error(const char *_what)
+    {
+        throw std::system_error{errno, std::generic_category(), _what};
+    }
+
+    /**
+     * @brief Calculates the size of one mapping.
+     *
+     * The size is a multiple of the page size and of the content type size.
+     *
+     * @param _capacity The minimal capacity of the buffer.
+     * @return The size of one mapping in bytes.
+     */
+    static std::size_t byte_size_for(const std::size_t &_capacity)
+    {
+        const std::size_t page_size{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+
+        std::size_t byte_size{(_capacity * sizeof(content_type) + page_size - 1) / page_size * page_size};
+        if (byte_size == 0) {
+            byte_size = page_size;
+        }
+
+        while (byte_size % sizeof(content_type) != 0) {
+            byte_size += page_size;
+        }
+
+        return byte_size;
+    }
+
+    /**
+     * @brief Maps an anonymous file twice into a contiguous address range.
+     *
+     * @param _byte_size The size of one mapping.
+     * @return The start of the first mapping.
+     */
+    static content_type *map(const std::size_t &_byte_size)
+    {
+        const int file{memfd_create("circular_buffer", MFD_CLOEXEC)};
+        if (file < 0) {
+            throw_system_error("memfd_create");
+        }
+
+        if (ftruncate(file, static_cast<off_t>(_byte_size)) != 0) {
+            const int error{errno};
+            close(file);
+            errno = error;
+            throw_system_error("ftruncate");
+        }
+
+        // Reserve the address range for both mappings first, so that no other
+        // mapping can be placed between them.
+        void *const reserved{mmap(nullptr, 2 * _byte_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+        if (reserved == MAP_FAILED) {
+            const int error{errno};
+            close(file);
+            errno = error;
+            throw_system_error("mmap");
+        }
+
+        unsigned char *const start{static_cast<unsigned char *>(reserved)};
+        for (std::size_t i{0}; i < 2; ++i) {
+            if (mmap(start + i * _byte_size, _byte_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file, 0) == MAP_FAILED) {
+                const int error{errno};
+                munmap(reserved, 2 * _byte_size);
+                close(file);
+                errno = error;
+                throw_system_error("mmap");
+            }
+        }
+
+        // The mappings keep the file alive.
+        close(file);
+
+        return reinterpret_cast<content_type *>(start);
+    }
+
+  private: // Functionality
+    /**
+     * @brief Unmaps the buffer memory if used.
+     */
+    void unmap()
+    {
+        if (m_data) {
+            munmap(m_data, 2 * m_byte_size);
+        }
+    }
+
+  public: // Operators
+    /**
+     * @brief Assignment operator.
+     */
+    circular_buffer &operator=(const circular_buffer<content_type> &_other)
+    {
+        if (this == &_other) {
+            return *this;
+        }
+
+        content_type *const data{map(_other.m_byte_size)};
+        std::memcpy(data, _other.m_data, _other.m_byte_size);
+
+        unmap();
+
+        m_byte_size   = _other.m_byte_size;
+        m_data        = data;
+        m_first_free  = _other.m_first_free;
+        m_first_valid = _other.m_first_valid;
+
+        return *this;
+    }
+
+    /**
+     * @brief Move operator.
+     */
+    circular_buffer &operator=(circular_buffer<content_type> &&_other)
+    {
+        if (this == &_other) {
+            return *this;
+        }
+
+        unmap();
+
+        m_byte_size   = _other.m_byte_size;
+        m_data        = _other.m_data;
+        m_first_free  = _other.m_first_free;
+        m_first_valid = _other.m_first_valid;
+
+        _other.m_data = nullptr;
+
+        return *this;
+    }
+};
+
+#endif // CIRCULAR_BUFFER_HPP_
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+
+#include "circular_buffer.hpp"
+
+/**
+ * @brief Print the content of the circular buffer.
+ *
+ * The values are read in place as one contiguous range, even if they wrap
+ * around the end of the buffer, and removed from the buffer afterwards.
+ *
+ * @param _buffer The circular buffer.
+ */
+template <typename _content_type>
+void print_buffer(circular_buffer<_content_type> &_buffer)
+{
+    std::cout << "[";
+
+    const _content_type *values{_buffer.read_ptr()};
+    for (std::size_t i{0}; i < _buffer.size(); ++i) {
+        std::cout << ' ' << values[i];
+    }
+
+    _buffer.commit_read(_buffer.size());
+
+    std::cout << " ]\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * @return The exit status.
+ */
+int main()
+{
+    circular_buffer<int> buffer{20};
+
+    // Move the indices close to the end of the buffer, so that the following
+    // values wrap around.
+    buffer.commit_write(buffer.capacity() - 5);
+    buffer.commit_read(buffer.capacity() - 5);
+
+    for (std::size_t i{0}; i < 11; ++i) {
+        buffer.push(-5 + static_cast<int>(i));
+    }
+
+    print_buffer(buffer);
+
+    return 0;
+}
@@ -0,0 +1,374 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef AWAITABLE_CIRCULAR_BUFFER_HPP_
+#define AWAITABLE_CIRCULAR_BUFFER_HPP_
+
+#include <coroutine>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "circular_buffer.hpp"
+#include "scheduler.hpp"
+
+/**
+ * @brief A circular buffer, whose values can be awaited by coroutines.
+ *
+ * A coroutine popping from an empty buffer or pushing to a full buffer is
+ * suspended and scheduled again as soon as the other side made progress. If
+ * the other side is already waiting, the value is handed over directly, so a
+ * resumed coroutine never has to check the buffer again. All coroutines are
+ * expected to run on the same scheduler.
+ */
+template <typename _content_type, std::size_t _capacity>
+class awaitable_circular_buffer {
+  public: // Typedefs
+    /**
+     * @brief The content type of the buffer.
+     */
+    typedef _content_type content_type;
+
+  public: // Static member variables
+    static const constexpr std::size_t capacity{_capacity};
+
+  public: // Classes
+    /**
+     * @brief Awaitable returned by pop_async().
+     */
+    class pop_awaiter {
+      private: // Member variables
+        /**
+         * @brief The awaited buffer.
+         */
+        awaitable_circular_buffer &m_buffer;
+
+        /**
+         * @brief The popped value, once it is available.
+         */
+        std::optional<content_type> m_value;
+
+        /**
+         * @brief The suspended coroutine.
+         */
+        std::coroutine_handle<> m_handle;
+
+        /**
+         * @brief The next waiting consumer.
+         */
+        pop_awaiter *m_next;
+
+      private: // Constructor
+        /**
+         * @brief Creates an awaiter for the given buffer.
+         *
+         * @param _buffer The awaited buffer.
+         */
+        explicit pop_awaiter(awaitable_circular_buffer &_buffer)
+            : m_buffer{_buffer},
+              m_value{},
+              m_handle{},
+              m_next{nullptr}
+        {
+        }
+
+      public: // Functionality
+        /**
+         * @brief Pops the value right away if the buffer is not empty or a
+         *        producer is waiting.
+         */
+        bool await_ready()
+        {
+            return m_buffer.take(m_value);
+        }
+
+        /**
+         * @brief Waits for a producer handing over a value.
+         *
+         * @param _handle The suspended coroutine.
+         */
+        void await_suspend(const std::coroutine_handle<> &_handle)
+        {
+            m_handle = _handle;
+            m_buffer.enqueue(m_buffer.m_first_consumer, m_buffer.m_last_consumer, this);
+        }
+
+        /**
+         * @brief Returns the popped value.
+         */
+        content_type await_resume()
+        {
+            return std::move(*m_value);
+        }
+
+      private: // Friends
+        friend awaitable_circular_buffer;
+    };
+
+    /**
+     * @brief Awaitable returned by push_async().
+     */
+    class push_awaiter {
+      private: // Member variables
+        /**
+         * @brief The awaited buffer.
+         */
+        awaitable_circular_buffer &m_buffer;
+
+        /**
+         * @brief The value that is pushed.
+         */
+        content_type m_value;
+
+        /**
+         * @brief The suspended coroutine.
+         */
+        std::coroutine_handle<> m_handle;
+
+        /**
+         * @brief The next waiting producer.
+         */
+        push_awaiter *m_next;
+
+      private: // Constructor
+        /**
+         * @brief Creates an awaiter for the given buffer.
+         *
+         * @param _buffer The awaited buffer.
+         * @param _value The value that is pushed.
+         */
+        push_awaiter(awaitable_circular_buffer &_buffer, const content_type &_value)
+            : m_buffer{_buffer},
+              m_value{_value},
+              m_handle{},
+              m_next{nullptr}
+        {
+        }
+
+      public: // Functionality
+        /**
+         * @brief Pushes the value right away if a consumer is waiting or the
+         *        buffer is not full.
+         */
+        bool await_ready()
+        {
+            return m_buffer.give(m_value);
+        }
+
+        /**
+         * @brief Waits for a consumer taking a value.
+         *
+         * @param _handle The suspended coroutine.
+         */
+        void await_suspend(const std::coroutine_handle<> &_handle)
+        {
+            m_handle = _handle;
+            m_buffer.enqueue(m_buffer.m_first_producer, m_buffer.m_last_producer, this);
+        }
+
+        /**
+         * @brief Nothing is returned after pushing.
+         */
+        void await_resume()
+        {
+        }
+
+      private: // Friends
+        friend awaitable_circular_buffer;
+    };
+
+  private: // Member variables
+    /**
+     * @brief The scheduler resuming waiting coroutines.
+     */
+    scheduler &m_scheduler;
+
+    /**
+     * @brief The underlying buffer.
+     *
+     * Only one slot is kept free, so capacity - 1 values can be saved.
+     */
+    circular_buffer<content_type, capacity, reject_policy> m_buffer;
+
+    /**
+     * @brief The first consumer waiting for a value.
+     *
+     * Consumers only wait if the buffer is empty.
+     */
+    pop_awaiter *m_first_consumer;
+
+    /**
+     * @brief The last consumer waiting for a value.
+     */
+    pop_awaiter *m_last_consumer;
+
+    /**
+     * @brief The first producer waiting for a free slot.
+     *
+     * Producers only wait if the buffer is full.
+     */
+    push_awaiter *m_first_producer;
+
+    /**
+     * @brief The last producer waiting for a free slot.
+     */
+    push_awaiter *m_last_producer;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs an empty buffer.
+     *
+     * @param _scheduler The scheduler resuming waiting coroutines.
+     */
+    explicit awaitable_circular_buffer(scheduler &_scheduler)
+        : m_scheduler{_scheduler},
+          m_buffer{},
+          m_first_consumer{nullptr},
+          m_last_consumer{nullptr},
+          m_first_producer{nullptr},
+          m_last_producer{nullptr}
+    {
+    }
+
+    /**
+     * @brief Waiting coroutines refer to the buffer, so it can not be copied.
+     */
+    awaitable_circular_buffer(const awaitable_circular_buffer &_other) = delete;
+
+  public: // Getter
+    /**
+     * @brief The amount of saved data in the buffer.
+     */
+    std::size_t size() const
+    {
+        return m_buffer.size();
+    }
+
+  public: // Functionality
+    /**
+     * @brief Removes the first value of the buffer.
+     *
+     * @return An awaitable returning the value.
+     */
+    pop_awaiter pop_async()
+    {
+        return pop_awaiter{*this};
+    }
+
+    /**
+     * @brief Adds a value to the buffer.
+     *
+     * @param _value The value that is added to the buffer.
+     * @return An awaitable completing as soon as the value was added.
+     */
+    push_awaiter push_async(const content_type &_value)
+    {
+        return push_awaiter{*this, _value};
+    }
+
+  private: // Static functionality
+    /**
+     * @brief Appends a waiting coroutine to a queue.
+     *
+     * @param _first The first waiting coroutine.
+     * @param _last The last waiting coroutine.
+     * @param _awaiter The new waiting coroutine.
+     */
+    template <typename _awaiter_type>
+    static void enqueue(_awaiter_type *&_first, _awaiter_type *&_last, _awaiter_type *_awaiter)
+    {
+        if (_last) {
+            _last->m_next = _awaiter;
+        } else {
+            _first = _awaiter;
+        }
+
+        _last = _awaiter;
+    }
+
+    /**
+     * @brief Removes the first waiting coroutine from a queue.
+     *
+     * @param _first The first waiting coroutine.
+     * @param _last The last waiting coroutine.
+     * @return The removed coroutine or nullptr if none is waiting.
+     */
+    template <typename _awaiter_type>
+    static _awaiter_type *dequeue(_awaiter_type *&_first, _awaiter_type *&_last)
+    {
+        _awaiter_type *const awaiter{_first};
+
+        if (awaiter) {
+            _first = awaiter->m_next;
+
+            if (!_first) {
+                _last = nullptr;
+            }
+        }
+
+        return awaiter;
+    }
+
+  private: // Functionality
+    /**
+     * @brief Pops a value from the buffer or takes it from the first waiting
+     *        producer, which is scheduled again.
+     *
+     * If a value was popped from the buffer, the freed slot is filled with
+     * the value of the first waiting producer.
+     *
+     * @param _value Receives the value.
+     * @return False if no value is available and the consumer has to wait.
+     */
+    bool take(std::optional<content_type> &_value)
+    {
+        push_awaiter *const producer{dequeue(m_first_producer, m_last_producer)};
+
+        if (m_buffer.size() > 0) {
+            _value.emplace(m_buffer.pop());
+
+            if (producer) {
+                m_buffer.try_push(producer->m_value);
+            }
+        } else if (producer) {
+            _value.emplace(std::move(producer->m_value));
+        } else {
+            return false;
+        }
+
+        if (producer) {
+            m_scheduler.schedule(producer->m_handle);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Hands a value to the first waiting consumer, which is scheduled
+     *        again, or pushes it to the buffer.
+     *
+     * @param _value The value that is added.
+     * @return False if the buffer is full and the producer has to wait.
+     */
+    bool give(const content_type &_value)
+    {
+        pop_awaiter *const consumer{dequeue(m_first_consumer, m_last_consumer)};
+        if (consumer) {
+            consumer->m_value.emplace(_value);
+            m_scheduler.schedule(consumer->m_handle);
+
+            return true;
+        }
+
+        return m_buffer.try_push(_value);
+    }
+
+  public: // Operators
+    /**
+     * @brief Waiting coroutines refer to the buffer, so it can not be
+     *        assigned.
+     */
+    awaitable_circular_buffer &operator=(const awaitable_circular_buffer &_other) = delete;
+};
+
+#endif // AWAITABLE_CIRCULAR_BUFFER_HPP_
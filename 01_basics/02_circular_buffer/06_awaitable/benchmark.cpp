@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "awaitable_circular_buffer.hpp"
+#include "circular_buffer.hpp"
+#include "scheduler.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The buffer capacity used by both benchmarks.
+ *
+ * A buffer of this capacity saves a single value, so producer and consumer
+ * have to switch after every value.
+ */
+static const constexpr std::size_t s_capacity{2};
+
+/**
+ * @brief Prints the result of a benchmark.
+ *
+ * @param _name The name of the benchmark.
+ * @param _count The amount of handed over values.
+ * @param _sum The sum of all received values.
+ * @param _elapsed The measured time.
+ */
+void print_result(const char *_name, const std::uint64_t &_count, const std::uint64_t &_sum, const std::chrono::duration<double, std::nano> &_elapsed)
+{
+    if (_sum != _count * (_count - 1) / 2) {
+        std::cerr << _name << " lost values.\n";
+        std::exit(1);
+    }
+
+    std::cout << _name << ": " << _count << " values, "
+              << _elapsed.count() / static_cast<double>(_count) << " ns per value\n";
+}
+
+/**
+ * @brief Pushes the values 0 to _count - 1.
+ *
+ * @param _buffer The circular buffer.
+ * @param _count The amount of values.
+ */
+task produce(awaitable_circular_buffer<std::uint64_t, s_capacity> &_buffer, std::uint64_t _count)
+{
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        co_await _buffer.push_async(i);
+    }
+}
+
+/**
+ * @brief Sums up _count popped values.
+ *
+ * @param _buffer The circular buffer.
+ * @param _count The amount of values.
+ * @param _sum Receives the sum.
+ */
+task consume(awaitable_circular_buffer<std::uint64_t, s_capacity> &_buffer, std::uint64_t _count, std::uint64_t &_sum)
+{
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        _sum += co_await _buffer.pop_async();
+    }
+}
+
+/**
+ * @brief Measures a coroutine consumer resumed by a single-threaded
+ *        scheduler.
+ *
+ * @param _count The amount of handed over values.
+ */
+void benchmark_coroutine(const std::uint64_t &_count)
+{
+    scheduler                                           tasks{};
+    awaitable_circular_buffer<std::uint64_t, s_capacity> buffer{tasks};
+
+    std::uint64_t sum{0};
+
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    tasks.spawn(consume(buffer, _count, sum));
+    tasks.spawn(produce(buffer, _count));
+    tasks.run();
+
+    print_result("coroutine", _count, sum, benchmark_clock::now() - start);
+}
+
+/**
+ * @brief Measures a consumer thread waiting on a condition variable.
+ *
+ * @param _count The amount of handed over values.
+ */
+void benchmark_condition_variable(const std::uint64_t &_count)
+{
+    circular_buffer<std::uint64_t, s_capacity, reject_policy> buffer{};
+
+    std::mutex              mutex{};
+    std::condition_variable not_empty{};
+    std::condition_variable not_full{};
+
+    std::uint64_t sum{0};
+
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    std::thread consumer{[&]() {
+        for (std::uint64_t i{0}; i < _count; ++i) {
+            std::unique_lock<std::mutex> lock{mutex};
+            not_empty.wait(lock, [&buffer]() { return buffer.size() > 0; });
+
+            sum += buffer.pop();
+
+            lock.unlock();
+            not_full.notify_one();
+        }
+    }};
+
+    for (std::uint64_t i{0}; i < _count; ++i) {
+        std::unique_lock<std::mutex> lock{mutex};
+        not_full.wait(lock, [&buffer]() { return buffer.free_size() > 0; });
+
+        buffer.push(i);
+
+        lock.unlock();
+        not_empty.notify_one();
+    }
+
+    consumer.join();
+
+    print_result("condition variable", _count, sum, benchmark_clock::now() - start);
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument is the amount of handed over values.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t count{1000000};
+    if (_argc > 1) {
+        count = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    benchmark_coroutine(count);
+    benchmark_condition_variable(count);
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+
+#include "awaitable_circular_buffer.hpp"
+#include "scheduler.hpp"
+
+/**
+ * @brief The buffer type used by the coroutines.
+ */
+typedef awaitable_circular_buffer<int, 4> buffer_type;
+
+/**
+ * @brief Pushes the values -5 to 5 to the buffer.
+ *
+ * @param _buffer The circular buffer.
+ */
+task produce(buffer_type &_buffer)
+{
+    for (int i{-5}; i <= 5; ++i) {
+        co_await _buffer.push_async(i);
+    }
+}
+
+/**
+ * @brief Prints the given amount of values popped from the buffer.
+ *
+ * @param _buffer The circular buffer.
+ * @param _count The amount of values that are printed.
+ */
+task print_buffer(buffer_type &_buffer, std::size_t _count)
+{
+    std::cout << "[";
+
+    for (; _count > 0; --_count) {
+        std::cout << ' ' << co_await _buffer.pop_async();
+    }
+
+    std::cout << " ]\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The consumer is started first and suspended until the producer pushed the
+ * first value, the producer is suspended whenever the buffer is full.
+ *
+ * @return The exit status.
+ */
+int main()
+{
+    scheduler   tasks{};
+    buffer_type buffer{tasks};
+
+    tasks.spawn(print_buffer(buffer, 11));
+    tasks.spawn(produce(buffer));
+    tasks.run();
+
+    return 0;
+}
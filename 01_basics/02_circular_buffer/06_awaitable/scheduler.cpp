@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+task task::promise_type::get_return_object()
+{
+    return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+std::suspend_always task::promise_type::initial_suspend() noexcept
+{
+    return {};
+}
+
+std::suspend_always task::promise_type::final_suspend() noexcept
+{
+    return {};
+}
+
+void task::promise_type::return_void()
+{
+}
+
+void task::promise_type::unhandled_exception()
+{
+    std::terminate();
+}
+
+task::task(const std::coroutine_handle<promise_type> &_handle)
+    : m_handle{_handle}
+{
+}
+
+task::task(task &&_other)
+    : m_handle{std::exchange(_other.m_handle, nullptr)}
+{
+}
+
+task::~task()
+{
+    if (m_handle) {
+        m_handle.destroy();
+    }
+}
+
+scheduler::~scheduler()
+{
+    for (std::coroutine_handle<> &handle : m_tasks) {
+        handle.destroy();
+    }
+}
+
+void scheduler::spawn(task &&_task)
+{
+    const std::coroutine_handle<> handle{std::exchange(_task.m_handle, nullptr)};
+
+    m_tasks.push_back(handle);
+    schedule(handle);
+}
+
+void scheduler::schedule(const std::coroutine_handle<> &_handle)
+{
+    m_ready.push_back(_handle);
+}
+
+void scheduler::run()
+{
+    while (!m_ready.empty()) {
+        const std::coroutine_handle<> handle{m_ready.front()};
+        m_ready.pop_front();
+
+        handle.resume();
+    }
+
+    // Destroy finished coroutines, the others are still waiting for a buffer.
+    const auto finished{std::remove_if(m_tasks.begin(), m_tasks.end(), [](const std::coroutine_handle<> &_handle) {
+        if (_handle.done()) {
+            _handle.destroy();
+            return true;
+        }
+
+        return false;
+    })};
+
+    m_tasks.erase(finished, m_tasks.end());
+}
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef SCHEDULER_HPP_
+#define SCHEDULER_HPP_
+
+#include <coroutine>
+#include <deque>
+#include <vector>
+
+/**
+ * @brief The return type of a coroutine that is run by a scheduler.
+ *
+ * The coroutine does not start before it is spawned on a scheduler.
+ */
+class task {
+  public: // Classes
+    /**
+     * @brief The promise type required by the coroutine machinery.
+     */
+    class promise_type {
+      public: // Functionality
+        /**
+         * @brief Creates the task owning the coroutine.
+         */
+        task get_return_object();
+
+        /**
+         * @brief The coroutine is suspended until it is scheduled.
+         */
+        std::suspend_always initial_suspend() noexcept;
+
+        /**
+         * @brief The coroutine stays suspended after finishing, so that the
+         *        scheduler can destroy it.
+         */
+        std::suspend_always final_suspend() noexcept;
+
+        /**
+         * @brief Nothing is returned by a task.
+         */
+        void return_void();
+
+        /**
+         * @brief Exceptions are not supported and terminate the program.
+         */
+        void unhandled_exception();
+    };
+
+  private: // Member variables
+    /**
+     * @brief The owned coroutine.
+     *
+     * Is invalid if the task was moved.
+     */
+    std::coroutine_handle<promise_type> m_handle;
+
+  private: // Constructors
+    /**
+     * @brief Creates a task owning the given coroutine.
+     *
+     * @param _handle The coroutine.
+     */
+    explicit task(const std::coroutine_handle<promise_type> &_handle);
+
+  public: // Constructors and destructor
+    /**
+     * @brief A task owns its coroutine and can not be copied.
+     */
+    task(const task &_other) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    task(task &&_other);
+
+    /**
+     * @brief Destroys the coroutine if it is still owned.
+     */
+    ~task();
+
+  public: // Operators
+    /**
+     * @brief A task owns its coroutine and can not be assigned.
+     */
+    task &operator=(const task &_other) = delete;
+
+    /**
+     * @brief A task owns its coroutine and can not be assigned.
+     */
+    task &operator=(task &&_other) = delete;
+
+  private: // Friends
+    friend class scheduler;
+};
+
+/**
+ * @brief A minimal single-threaded scheduler for coroutines.
+ *
+ * Resumes scheduled coroutines one after another on the thread calling run().
+ */
+class scheduler {
+  private: // Member variables
+    /**
+     * @brief The coroutines that are ready to be resumed.
+     */
+    std::deque<std::coroutine_handle<>> m_ready;
+
+    /**
+     * @brief All spawned coroutines, which are destroyed with the scheduler.
+     */
+    std::vector<std::coroutine_handle<>> m_tasks;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs an empty scheduler.
+     */
+    scheduler() = default;
+
+    /**
+     * @brief Coroutines refer to their scheduler, so it can not be copied.
+     */
+    scheduler(const scheduler &_other) = delete;
+
+    /**
+     * @brief Destroys all spawned coroutines.
+     */
+    ~scheduler();
+
+  public: // Functionality
+    /**
+     * @brief Takes ownership of a task and schedules it.
+     *
+     * @param _task The task that is started.
+     */
+    void spawn(task &&_task);
+
+    /**
+     * @brief Schedules a suspended coroutine to be resumed.
+     *
+     * @param _handle The coroutine.
+     */
+    void schedule(const std::coroutine_handle<> &_handle);
+
+    /**
+     * @brief Resumes scheduled coroutines until none is ready anymore.
+     */
+    void run();
+
+  public: // Operators
+    /**
+     * @brief Coroutines refer to their scheduler, so it can not be assigned.
+     */
+    scheduler &operator=(const scheduler &_other) = delete;
+};
+
+#endif // SCHEDULER_HPP_
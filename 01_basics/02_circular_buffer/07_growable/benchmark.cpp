@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <queue>
+
+#include "circular_buffer.hpp"
+#include "counting_allocation.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief Adds a value to the back of a growable circular buffer.
+ */
+void push_back(circular_buffer<std::uint64_t> &_container, const std::uint64_t &_value)
+{
+    _container.push(_value);
+}
+
+/**
+ * @brief Removes the front value of a growable circular buffer.
+ */
+std::uint64_t pop_front(circular_buffer<std::uint64_t> &_container)
+{
+    return _container.pop();
+}
+
+/**
+ * @brief Adds a value to the back of a deque.
+ */
+void push_back(std::deque<std::uint64_t> &_container, const std::uint64_t &_value)
+{
+    _container.push_back(_value);
+}
+
+/**
+ * @brief Removes the front value of a deque.
+ */
+std::uint64_t pop_front(std::deque<std::uint64_t> &_container)
+{
+    const std::uint64_t value{_container.front()};
+    _container.pop_front();
+
+    return value;
+}
+
+/**
+ * @brief Adds a value to the back of a queue.
+ */
+void push_back(std::queue<std::uint64_t> &_container, const std::uint64_t &_value)
+{
+    _container.push(_value);
+}
+
+/**
+ * @brief Removes the front value of a queue.
+ */
+std::uint64_t pop_front(std::queue<std::uint64_t> &_container)
+{
+    const std::uint64_t value{_container.front()};
+    _container.pop();
+
+    return value;
+}
+
+/**
+ * @brief Fills the container in bursts and drains it again.
+ *
+ * @param _name The name of the container.
+ * @param _rounds The amount of bursts.
+ * @param _burst The amount of values pushed per burst.
+ */
+template <typename _container_type>
+void benchmark_bursts(const char *_name, const std::uint64_t &_rounds, const std::uint64_t &_burst)
+{
+    _container_type container{};
+
+    std::uint64_t sum{0};
+
+    const std::uint64_t               allocations{allocation_count()};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t round{0}; round < _rounds; ++round) {
+        for (std::uint64_t i{0}; i < _burst; ++i) {
+            push_back(container, i);
+        }
+
+        for (std::uint64_t i{0}; i < _burst; ++i) {
+            sum += pop_front(container);
+        }
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    std::cout << "bursts " << _name << ": "
+              << elapsed.count() / static_cast<double>(2 * _rounds * _burst) << " ns per operation, "
+              << allocation_count() - allocations << " allocations (checksum " << sum << ")\n";
+}
+
+/**
+ * @brief Keeps the container at a constant fill level while pushing and
+ *        popping values.
+ *
+ * @param _name The name of the container.
+ * @param _operations The amount of push and pop pairs.
+ * @param _fill_level The amount of values kept in the container.
+ */
+template <typename _container_type>
+void benchmark_steady(const char *_name, const std::uint64_t &_operations, const std::uint64_t &_fill_level)
+{
+    _container_type container{};
+
+    std::uint64_t sum{0};
+
+    const std::uint64_t               allocations{allocation_count()};
+    const benchmark_clock::time_point start{benchmark_clock::now()};
+
+    for (std::uint64_t i{0}; i < _fill_level; ++i) {
+        push_back(container, i);
+    }
+
+    for (std::uint64_t i{0}; i < _operations; ++i) {
+        push_back(container, i);
+        sum += pop_front(container);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+
+    std::cout << "steady " << _name << ": "
+              << elapsed.count() / static_cast<double>(2 * _operations) << " ns per operation, "
+              << allocation_count() - allocations << " allocations (checksum " << sum << ")\n";
+}
+
+/**
+ * @brief The main function.
+ *
+ * The first optional argument scales the amount of operations.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    std::uint64_t scale{100};
+    if (_argc > 1) {
+        scale = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    benchmark_bursts<circular_buffer<std::uint64_t>>("circular_buffer", scale, 100000);
+    benchmark_bursts<std::deque<std::uint64_t>>("std::deque", scale, 100000);
+    benchmark_bursts<std::queue<std::uint64_t>>("std::queue", scale, 100000);
+
+    benchmark_steady<circular_buffer<std::uint64_t>>("circular_buffer", scale * 100000, 1000);
+    benchmark_steady<std::deque<std::uint64_t>>("std::deque", scale * 100000, 1000);
+    benchmark_steady<std::queue<std::uint64_t>>("std::queue", scale * 100000, 1000);
+
+    return 0;
+}
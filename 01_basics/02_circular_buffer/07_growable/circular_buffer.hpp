@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef CIRCULAR_BUFFER_HPP_
+#define CIRCULAR_BUFFER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief A templated circular buffer, which grows when it is full.
+ *
+ * The capacity is always a power of two and doubles whenever a value is
+ * pushed to a full buffer, which results in amortized constant time for push.
+ * The buffer only shrinks when requested by shrink_to_fit(), so bursts of the
+ * same size reuse the memory, and never below the minimal capacity.
+ */
+template <typename _content_type>
+class circular_buffer {
+  public: // Typedefs
+    /**
+     * @brief The content type of the buffer.
+     */
+    typedef _content_type content_type;
+
+  private: // Typedefs
+    /**
+     * @brief The allocator used for the internal data representation.
+     */
+    typedef std::allocator<content_type> allocator_type;
+
+  private: // Member variables
+    /**
+     * @brief The capacity the buffer never shrinks below.
+     */
+    std::size_t m_minimal_capacity;
+
+    /**
+     * @brief The current capacity of the buffer.
+     */
+    std::size_t m_capacity;
+
+    /**
+     * @brief The internal data representation.
+     *
+     * Only the m_size slots starting at m_first_valid contain living values.
+     */
+    content_type *m_data;
+
+    /**
+     * @brief The first index in the data representation that is valid.
+     */
+    std::size_t m_first_valid;
+
+    /**
+     * @brief The amount of saved values.
+     */
+    std::size_t m_size;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Constructs a circular buffer.
+     *
+     * @param _minimal_capacity The capacity the buffer never shrinks below.
+     *                          It is rounded up to a power of two.
+     */
+    explicit circular_buffer(const std::size_t &_minimal_capacity = 16)
+        : m_minimal_capacity{round_up_capacity(_minimal_capacity)},
+          m_capacity{m_minimal_capacity},
+          m_data{allocator_type{}.allocate(m_capacity)},
+          m_first_valid{0},
+          m_size{0}
+    {
+    }
+
+    /**
+     * @brief Copy constructor.
+     */
+    circular_buffer(const circular_buffer<content_type> &_other)
+        : m_minimal_capacity{_other.m_minimal_capacity},
+          m_capacity{_other.m_capacity},
+          m_data{allocator_type{}.allocate(m_capacity)},
+          m_first_valid{0},
+          m_size{0}
+    {
+        for (std::size_t i{0}; i < _other.m_size; ++i) {
+            std::construct_at(m_data + i, _other.m_data[_other.index(i)]);
+            ++m_size;
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     *
+     * The other buffer is empty afterwards and allocates again when it is
+     * used.
+     */
+    circular_buffer(circular_buffer<content_type> &&_other)
+        : m_minimal_capacity{_other.m_minimal_capacity},
+          m_capacity{std::exchange(_other.m_capacity, 0)},
+          m_data{std::exchange(_other.m_data, nullptr)},
+          m_first_valid{std::exchange(_other.m_first_valid, 0)},
+          m_size{std::exchange(_other.m_size, 0)}
+    {
+    }
+
+    /**
+     * @brief Destroy the saved values and free buffer memory if used.
+     */
+    ~circular_buffer()
+    {
+        release();
+    }
+
+  public: // Getter
+    /**
+     * @brief The current capacity of the buffer.
+     */
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief The amount of saved data in the buffer.
+     */
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+  public: // Functionality
+    /**
+     * @brief Adds a new value to the buffer.
+     *
+     * Doubles the capacity if the buffer is full.
+     *
+     * @param _value The value that is added to the buffer.
+     */
+    void push(const content_type &_value)
+    {
+        emplace(_value);
+    }
+
+    /**
+     * @brief Adds a new value to the buffer.
+     *
+     * Doubles the capacity if the buffer is full.
+     *
+     * @param _value The value that is moved to the buffer.
+     */
+    void push(content_type &&_value)
+    {
+        emplace(std::move(_value));
+    }
+
+    /**
+     * @brief Constructs a new value in place at the end of the buffer.
+     *
+     * Doubles the capacity if the buffer is full.
+     *
+     * @param _args The arguments passed to the constructor of the value.
+     */
+    template <typename... _arg_types>
+    void emplace(_arg_types &&..._args)
+    {
+        if (m_size == m_capacity) {
+            reallocate(std::max(2 * m_capacity, m_minimal_capacity));
+        }
+
+        std::construct_at(m_data + index(m_size), std::forward<_arg_types>(_args)...);
+        ++m_size;
+    }
+
+    /**
+     * @brief Removes the first value of the buffer and returns it.
+     *
+     * Might result in UB if the buffer underflows.
+     *
+     * @return The first value of the buffer.
+     */
+    content_type pop()
+    {
+        content_type value{std::move(m_data[m_first_valid])};
+
+        std::destroy_at(m_data + m_first_valid);
+        m_first_valid = index(1);
+        --m_size;
+
+        return value;
+    }
+
+    /**
+     * @brief Reduces the capacity to the smallest power of two that fits the
+     *        saved values, but not below the minimal capacity.
+     */
+    void shrink_to_fit()
+    {
+        const std::size_t capacity{std::max(round_up_capacity(m_size), m_minimal_capacity)};
+
+        if (capacity < m_capacity) {
+            reallocate(capacity);
+        }
+    }
+
+  private: // Static functionality
+    /**
+     * @brief Rounds a capacity up to the next power of two.
+     *
+     * @param _capacity The requested capacity.
+     * @return The smallest power of two that is not smaller than the
+     *         requested capacity.
+     */
+    static std::size_t round_up_capacity(const std::size_t &_capacity)
+    {
+        std::size_t capacity{1};
+        while (capacity < _capacity) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+
+  private: // Functionality
+    /**
+     * @brief Maps an offset from the first value to an index in the data
+     *        representation.
+     *
+     * @param _offset The offset from the first value.
+     * @return The index in the data representation.
+     */
+    std::size_t index(const std::size_t &_offset) const
+    {
+        return (m_first_valid + _offset) & (m_capacity - 1);
+    }
+
+    /**
+     * @brief Moves the values to a new data representation.
+     *
+     * The values are unwrapped, so that the first value is at the start of the
+     * new data representation.
+     *
+     * @param _capacity The new capacity, which is a power of two and not
+     *                  smaller than the current size.
+     */
+    void reallocate(const std::size_t &_capacity)
+    {
+        content_type *const data{allocator_type{}.allocate(_capacity)};
+
+        const std::size_t first_count{std::min(m_size, m_capacity - m_first_valid)};
+
+        std::uninitialized_move(m_data + m_first_valid, m_data + m_first_valid + first_count, data);
+        std::uninitialized_move(m_data, m_data + m_size - first_count, data + first_count);
+
+        const std::size_t size{m_size};
+        release();
+
+        m_capacity    = _capacity;
+        m_data        = data;
+        m_first_valid = 0;
+        m_size        = size;
+    }
+
+    /**
+     * @brief Destroys the saved values and frees buffer memory if used.
+     */
+    void release()
+    {
+        if (!m_data) {
+            return;
+        }
+
+        for (std::size_t i{0}; i < m_size; ++i) {
+            std::destroy_at(m_data + index(i));
+        }
+
+        allocator_type{}.deallocate(m_data, m_capacity);
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+  public: // Operators
+    /**
+     * @brief Assignment operator.
+     */
+    circular_buffer &operator=(const circular_buffer<content_type> &_other)
+    {
+        if (this != &_other) {
+            circular_buffer<content_type> copy{_other};
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move operator.
+     */
+    circular_buffer &operator=(circular_buffer<content_type> &&_other)
+    {
+        if (this != &_other) {
+            release();
+
+            m_minimal_capacity = _other.m_minimal_capacity;
+            m_capacity         = std::exchange(_other.m_capacity, 0);
+            m_data             = std::exchange(_other.m_data, nullptr);
+            m_first_valid      = std::exchange(_other.m_first_valid, 0);
+            m_size             = std::exchange(_other.m_size, 0);
+        }
+
+        return *this;
+    }
+};
+
+#endif // CIRCULAR_BUFFER_HPP_
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "benchmark.hpp"
+
+std::uint64_t benchmark_rounds(int _argc, char **_argv)
+{
+    std::uint64_t rounds{20000};
+    if (_argc > 1) {
+        rounds = std::strtoull(_argv[1], nullptr, 10);
+    }
+
+    return rounds == 0 ? 1 : rounds;
+}
+
+void print_json(const std::vector<benchmark_result> &_results)
+{
+    std::cout << "{\n  \"benchmarks\": [";
+
+    for (std::size_t i{0}; i < _results.size(); ++i) {
+        const benchmark_result &result{_results[i]};
+
+        std::cout << (i == 0 ? "\n" : ",\n")
+                  << "    {\n"
+                  << "      \"implementation\": \"" << result.implementation << "\",\n"
+                  << "      \"content_type\": \"" << result.content_type << "\",\n"
+                  << "      \"content_size\": " << result.content_size << ",\n"
+                  << "      \"throughput_ops_per_second\": " << result.throughput << ",\n"
+                  << "      \"cache_misses\": ";
+
+        if (result.cache_misses) {
+            std::cout << *result.cache_misses;
+        } else {
+            std::cout << "null";
+        }
+
+        std::cout << ",\n      \"latency_ns\": {";
+        for (std::size_t j{0}; j < s_percentiles.size(); ++j) {
+            std::cout << (j == 0 ? "" : ", ") << "\"p" << s_percentiles[j] << "\": " << result.latency_percentiles[j];
+        }
+
+        std::cout << "},\n"
+                  << "      \"allocations\": " << result.allocations << ",\n"
+                  << "      \"checksum\": " << result.checksum << "\n"
+                  << "    }";
+    }
+
+    std::cout << "\n  ]\n}\n";
+}
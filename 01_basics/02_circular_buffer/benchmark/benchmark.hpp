@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "counting_allocation.hpp"
+
+/**
+ * @brief The clock used for all measurements.
+ */
+typedef std::chrono::steady_clock benchmark_clock;
+
+/**
+ * @brief The capacity used for all buffers, which is fixed by the hardcoded
+ *        variants.
+ */
+static const constexpr std::size_t s_capacity{300};
+
+/**
+ * @brief The amount of values pushed before they are popped again.
+ *
+ * The hardcoded variants do not detect overflows, so the buffers are never
+ * filled completely.
+ */
+static const constexpr std::size_t s_burst{256};
+
+/**
+ * @brief The amount of operations measured together for the latency.
+ *
+ * A single push or pop is too short to be measured by the clock.
+ */
+static const constexpr std::size_t s_latency_batch{32};
+
+/**
+ * @brief A value of a given size used as buffer content.
+ */
+template <std::size_t _size>
+struct payload {
+    /**
+     * @brief Verify that the payload consists of whole words.
+     */
+    static_assert(_size % sizeof(std::uint64_t) == 0, "The payload size is required to be a multiple of 8.");
+
+    /**
+     * @brief The payload data.
+     */
+    std::uint64_t values[_size / sizeof(std::uint64_t)];
+};
+
+/**
+ * @brief Creates a buffer value from a counter.
+ */
+template <typename _content_type>
+_content_type make_value(const std::uint64_t &_counter)
+{
+    if constexpr (std::is_integral_v<_content_type>) {
+        return static_cast<_content_type>(_counter);
+    } else {
+        _content_type value{};
+        value.values[0] = _counter;
+        return value;
+    }
+}
+
+/**
+ * @brief Reduces a buffer value to a number, so that it can not be optimized
+ *        away.
+ */
+template <typename _content_type>
+std::uint64_t checksum(const _content_type &_value)
+{
+    if constexpr (std::is_integral_v<_content_type>) {
+        return static_cast<std::uint64_t>(_value);
+    } else {
+        return _value.values[0];
+    }
+}
+
+/**
+ * @brief Counts the cache misses of the calling thread, if the performance
+ *        counters are available.
+ */
+class cache_miss_counter {
+  private: // Member variables
+    /**
+     * @brief The file descriptor of the counter, negative if unavailable.
+     */
+    int m_file;
+
+  public: // Constructors and destructor
+    /**
+     * @brief Opens and starts the counter.
+     */
+    cache_miss_counter()
+        : m_file{-1}
+    {
+#ifdef __linux__
+        perf_event_attr attributes{};
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled       = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+
+        m_file = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (m_file >= 0) {
+            ioctl(m_file, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_file, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /**
+     * @brief The counter is bound to its file descriptor.
+     */
+    cache_miss_counter(const cache_miss_counter &_other) = delete;
+
+    /**
+     * @brief Closes the counter.
+     */
+    ~cache_miss_counter()
+    {
+#ifdef __linux__
+        if (m_file >= 0) {
+            close(m_file);
+        }
+#endif
+    }
+
+  public: // Functionality
+    /**
+     * @brief Stops the counter.
+     *
+     * @return The counted cache misses or nothing if the counter is
+     *         unavailable.
+     */
+    std::optional<std::uint64_t> stop()
+    {
+#ifdef __linux__
+        std::uint64_t count{0};
+        if (m_file >= 0 && ioctl(m_file, PERF_EVENT_IOC_DISABLE, 0) == 0 && read(m_file, &count, sizeof(count)) == sizeof(count)) {
+            return count;
+        }
+#endif
+
+        return std::nullopt;
+    }
+
+  public: // Operators
+    /**
+     * @brief The counter is bound to its file descriptor.
+     */
+    cache_miss_counter &operator=(const cache_miss_counter &_other) = delete;
+};
+
+/**
+ * @brief The results of benchmarking one buffer with one content type.
+ */
+struct benchmark_result {
+    /**
+     * @brief The name of the buffer implementation.
+     */
+    std::string implementation;
+
+    /**
+     * @brief The name of the content type.
+     */
+    std::string content_type;
+
+    /**
+     * @brief The size of the content type in bytes.
+     */
+    std::size_t content_size;
+
+    /**
+     * @brief Push and pop operations per second when pushing and popping in
+     *        bursts.
+     */
+    double throughput;
+
+    /**
+     * @brief Cache misses during the throughput measurement.
+     */
+    std::optional<std::uint64_t> cache_misses;
+
+    /**
+     * @brief Latency percentiles per operation of the mixed workload in ns.
+     */
+    std::array<double, 4> latency_percentiles;
+
+    /**
+     * @brief Allocations done while constructing, using and destroying the
+     *        buffers.
+     */
+    std::uint64_t allocations;
+
+    /**
+     * @brief Checksum of all popped values, which keeps them from being
+     *        optimized away.
+     */
+    std::uint64_t checksum;
+};
+
+/**
+ * @brief The percentiles reported for the latency.
+ */
+static const constexpr std::array<double, 4> s_percentiles{50.0, 90.0, 99.0, 99.9};
+
+/**
+ * @brief Benchmarks one buffer implementation with one content type.
+ *
+ * @param _implementation The name of the buffer implementation.
+ * @param _content_name The name of the content type.
+ * @param _rounds The amount of bursts for the throughput and of batches for
+ *                the latency.
+ * @return The results.
+ */
+template <typename _buffer_type, typename _content_type>
+benchmark_result run_benchmark(const char *_implementation, const char *_content_name, const std::uint64_t &_rounds)
+{
+    benchmark_result result{_implementation, _content_name, sizeof(_content_type), 0.0, std::nullopt, {}, 0, 0};
+
+    const std::uint64_t allocations{allocation_count()};
+
+    std::unique_ptr<_buffer_type> buffer{new _buffer_type{}};
+
+    // Throughput: Push a burst of values and pop them again.
+    {
+        cache_miss_counter                cache_misses{};
+        const benchmark_clock::time_point start{benchmark_clock::now()};
+
+        for (std::uint64_t round{0}; round < _rounds; ++round) {
+            for (std::size_t i{0}; i < s_burst; ++i) {
+                buffer->push(make_value<_content_type>(round + i));
+            }
+
+            for (std::size_t i{0}; i < s_burst; ++i) {
+                result.checksum += checksum(buffer->pop());
+            }
+        }
+
+        const std::chrono::duration<double> elapsed{benchmark_clock::now() - start};
+
+        result.cache_misses = cache_misses.stop();
+        result.throughput   = static_cast<double>(2 * s_burst * _rounds) / elapsed.count();
+    }
+
+    // Latency: Randomly push or pop, while keeping the buffer half full.
+    {
+        std::vector<double> latencies(_rounds);
+        std::uint64_t       random{42};
+
+        for (std::size_t i{0}; i < s_burst / 2; ++i) {
+            buffer->push(make_value<_content_type>(i));
+        }
+
+        for (std::uint64_t round{0}; round < _rounds; ++round) {
+            const benchmark_clock::time_point start{benchmark_clock::now()};
+
+            for (std::size_t i{0}; i < s_latency_batch; ++i) {
+                random = random * 6364136223846793005u + 1442695040888963407u;
+
+                const bool push{(random >> 63) != 0};
+                if ((push && buffer->size() < s_burst) || buffer->size() == 0) {
+                    buffer->push(make_value<_content_type>(random));
+                } else {
+                    result.checksum += checksum(buffer->pop());
+                }
+            }
+
+            const std::chrono::duration<double, std::nano> elapsed{benchmark_clock::now() - start};
+            latencies[round] = elapsed.count() / static_cast<double>(s_latency_batch);
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        for (std::size_t i{0}; i < s_percentiles.size(); ++i) {
+            const std::size_t index{static_cast<std::size_t>(s_percentiles[i] / 100.0 * static_cast<double>(latencies.size() - 1))};
+            result.latency_percentiles[i] = latencies[index];
+        }
+    }
+
+    buffer.reset();
+
+    result.allocations = allocation_count() - allocations;
+
+    return result;
+}
+
+/**
+ * @brief Returns the amount of rounds per benchmark.
+ *
+ * The first optional argument of the executable is the amount of rounds.
+ *
+ * @param _argc The amount of arguments.
+ * @param _argv The arguments.
+ * @return The amount of rounds, which is at least one.
+ */
+std::uint64_t benchmark_rounds(int _argc, char **_argv);
+
+/**
+ * @brief Writes the results as JSON to stdout.
+ *
+ * @param _results The results of all benchmarks.
+ */
+void print_json(const std::vector<benchmark_result> &_results);
+
+#endif // BENCHMARK_HPP_
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "benchmark.hpp"
+
+/**
+ * @brief A std::deque with the interface of the circular buffers.
+ */
+template <typename _content_type>
+class deque_buffer {
+  private: // Member variables
+    /**
+     * @brief The underlying deque.
+     */
+    std::deque<_content_type> m_data;
+
+  public: // Getter
+    /**
+     * @brief The amount of saved data in the buffer.
+     */
+    std::size_t size() const
+    {
+        return m_data.size();
+    }
+
+  public: // Functionality
+    /**
+     * @brief Adds a new value to the buffer.
+     */
+    void push(const _content_type &_value)
+    {
+        m_data.push_back(_value);
+    }
+
+    /**
+     * @brief Removes the first value of the buffer and returns it.
+     */
+    _content_type pop()
+    {
+        const _content_type value{m_data.front()};
+        m_data.pop_front();
+
+        return value;
+    }
+};
+
+/**
+ * @brief The main function.
+ *
+ * Benchmarks std::deque for all content types.
+ * The first optional argument is the amount of rounds per benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    const std::uint64_t rounds{benchmark_rounds(_argc, _argv)};
+
+    std::vector<benchmark_result> results{};
+    results.push_back(run_benchmark<deque_buffer<int>, int>("std::deque", "int", rounds));
+    results.push_back(run_benchmark<deque_buffer<payload<16>>, payload<16>>("std::deque", "payload<16>", rounds));
+    results.push_back(run_benchmark<deque_buffer<payload<64>>, payload<64>>("std::deque", "payload<64>", rounds));
+
+    print_json(results);
+
+    return 0;
+}
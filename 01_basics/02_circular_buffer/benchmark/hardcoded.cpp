@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <vector>
+
+#include "../00_hardcoded/circular_buffer.hpp"
+#include "benchmark.hpp"
+
+/**
+ * @brief The main function.
+ *
+ * Benchmarks the hardcoded buffer, which only holds int values.
+ * The first optional argument is the amount of rounds per benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    const std::uint64_t rounds{benchmark_rounds(_argc, _argv)};
+
+    std::vector<benchmark_result> results{};
+    results.push_back(run_benchmark<circular_buffer, int>("hardcoded", "int", rounds));
+
+    print_json(results);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+/**
+ * @brief The executables benchmarking the variants.
+ *
+ * Every variant defines a class named circular_buffer, so each one is
+ * benchmarked by its own executable instead of being linked into one.
+ */
+static const constexpr std::array<const char *, 4> s_variants{
+    CIRCULAR_BUFFER_BENCHMARK_HARDCODED,
+    CIRCULAR_BUFFER_BENCHMARK_TEMPLATED_CONTENT,
+    CIRCULAR_BUFFER_BENCHMARK_TEMPLATED_CONTENT_AND_SIZE,
+    CIRCULAR_BUFFER_BENCHMARK_DEQUE,
+};
+
+/**
+ * @brief Runs a variant executable and returns the benchmarks of its JSON
+ *        output.
+ *
+ * @param _executable The path of the executable.
+ * @param _rounds The amount of rounds passed to the executable.
+ * @param _benchmarks Receives the comma separated benchmark objects.
+ * @return Whether the executable succeeded and wrote a benchmark array.
+ */
+bool run_variant(const char *_executable, const std::string &_rounds, std::string &_benchmarks)
+{
+    const std::string command{'"' + std::string{_executable} + "\" " + _rounds};
+
+    std::FILE *pipe{popen(command.c_str(), "r")};
+    if (!pipe) {
+        return false;
+    }
+
+    std::string            output{};
+    std::array<char, 4096> buffer{};
+    std::size_t            read{0};
+    while ((read = std::fread(buffer.data(), 1, buffer.size(), pipe)) > 0) {
+        output.append(buffer.data(), read);
+    }
+
+    if (pclose(pipe) != 0) {
+        return false;
+    }
+
+    const std::size_t begin{output.find('[')};
+    const std::size_t end{output.rfind(']')};
+    if (begin == std::string::npos || end == std::string::npos || end < begin) {
+        return false;
+    }
+
+    _benchmarks = output.substr(begin + 1, end - begin - 1);
+    _benchmarks.erase(_benchmarks.find_last_not_of(" \n") + 1);
+
+    return true;
+}
+
+/**
+ * @brief The main function.
+ *
+ * Runs the benchmark of every variant and writes all results as one JSON
+ * document to stdout. The first optional argument is the amount of rounds
+ * per benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    const std::string rounds{_argc > 1 ? std::to_string(std::strtoull(_argv[1], nullptr, 10)) : std::string{}};
+
+    std::string merged{};
+    for (const char *variant : s_variants) {
+        std::string benchmarks{};
+        if (!run_variant(variant, rounds, benchmarks)) {
+            std::cerr << "Benchmarking " << variant << " failed.\n";
+            return 1;
+        }
+
+        if (!benchmarks.empty()) {
+            merged += (merged.empty() ? "" : ",") + benchmarks;
+        }
+    }
+
+    std::cout << "{\n  \"benchmarks\": [" << merged << "\n  ]\n}\n";
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <vector>
+
+#include "../01_templated_content/circular_buffer.hpp"
+#include "benchmark.hpp"
+
+/**
+ * @brief The main function.
+ *
+ * Benchmarks the buffer with templated content for all content types.
+ * The first optional argument is the amount of rounds per benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    const std::uint64_t rounds{benchmark_rounds(_argc, _argv)};
+
+    std::vector<benchmark_result> results{};
+    results.push_back(run_benchmark<circular_buffer<int>, int>("templated_content", "int", rounds));
+    results.push_back(run_benchmark<circular_buffer<payload<16>>, payload<16>>("templated_content", "payload<16>", rounds));
+    results.push_back(run_benchmark<circular_buffer<payload<64>>, payload<64>>("templated_content", "payload<64>", rounds));
+
+    print_json(results);
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <vector>
+
+#include "../02_templated_content_and_size/circular_buffer.hpp"
+#include "benchmark.hpp"
+
+/**
+ * @brief The main function.
+ *
+ * Benchmarks the buffer with templated content and size for all content
+ * types.
+ * The first optional argument is the amount of rounds per benchmark.
+ *
+ * @return The exit status.
+ */
+int main(int _argc, char **_argv)
+{
+    const std::uint64_t rounds{benchmark_rounds(_argc, _argv)};
+
+    std::vector<benchmark_result> results{};
+    results.push_back(run_benchmark<circular_buffer<int, s_capacity>, int>("templated_content_and_size", "int", rounds));
+    results.push_back(run_benchmark<circular_buffer<payload<16>, s_capacity>, payload<16>>("templated_content_and_size", "payload<16>", rounds));
+    results.push_back(run_benchmark<circular_buffer<payload<64>, s_capacity>, payload<64>>("templated_content_and_size", "payload<64>", rounds));
+
+    print_json(results);
+
+    return 0;
+}
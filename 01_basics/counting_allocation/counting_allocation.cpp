@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#include "counting_allocation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief The amount of allocations done by the program.
+ *
+ * Atomic, as benchmarks with multiple threads allocate concurrently.
+ */
+static std::atomic<std::uint64_t> s_allocations{0};
+
+/**
+ * @brief Allocates memory using malloc and counts the allocation.
+ *
+ * @param _size The size of the memory.
+ * @return The allocated memory.
+ * @throws std::bad_alloc if no memory is available.
+ */
+static void *counted_allocate(const std::size_t &_size)
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *const pointer{std::malloc(_size == 0 ? 1 : _size)}) {
+        return pointer;
+    }
+
+    throw std::bad_alloc{};
+}
+
+/**
+ * @brief Allocates aligned memory using aligned_alloc and counts the
+ *        allocation.
+ *
+ * @param _size The size of the memory.
+ * @param _alignment The alignment of the memory.
+ * @return The allocated memory.
+ * @throws std::bad_alloc if no memory is available.
+ */
+static void *counted_allocate(const std::size_t &_size, const std::align_val_t &_alignment)
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    const std::size_t alignment{static_cast<std::size_t>(_alignment)};
+    const std::size_t size{(_size + alignment - 1) / alignment * alignment};
+
+    if (void *const pointer{std::aligned_alloc(alignment, size == 0 ? alignment : size)}) {
+        return pointer;
+    }
+
+    throw std::bad_alloc{};
+}
+
+std::uint64_t allocation_count()
+{
+    return s_allocations.load(std::memory_order_relaxed);
+}
+
+void *operator new(std::size_t _size)
+{
+    return counted_allocate(_size);
+}
+
+void *operator new[](std::size_t _size)
+{
+    return counted_allocate(_size);
+}
+
+void *operator new(std::size_t _size, std::align_val_t _alignment)
+{
+    return counted_allocate(_size, _alignment);
+}
+
+void *operator new[](std::size_t _size, std::align_val_t _alignment)
+{
+    return counted_allocate(_size, _alignment);
+}
+
+void operator delete(void *_pointer) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void *_pointer, std::size_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer, std::size_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void *_pointer, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void *_pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: 2023 J0R0U <https://github.com/J0R0U>
+// SPDX-License-Identifier: MIT
+
+#ifndef COUNTING_ALLOCATION_HPP_
+#define COUNTING_ALLOCATION_HPP_
+
+#include <cstdint>
+
+/**
+ * @brief The amount of allocations done by the program.
+ *
+ * Linking the counting_allocation library replaces all global allocation and
+ * deallocation functions, including the array and aligned variants, by
+ * versions based on malloc and free, which count every allocation.
+ *
+ * @return The amount of allocations since the start of the program.
+ */
+std::uint64_t allocation_count();
+
+#endif // COUNTING_ALLOCATION_HPP_